@@ -0,0 +1,149 @@
+#include <stdio.h>  /* printf */
+#include <stdlib.h> /* malloc, free */
+#include <time.h>   /* clock */
+
+#include "bitarray.h"
+
+#define NUM_OF_WORDS (1 << 20)
+#define REPEATS 20
+#define NSEC_IN_SEC 1e9
+
+typedef size_t (*count_func_t)(bitarray_t);
+typedef bitarray_t (*mirror_func_t)(bitarray_t);
+
+typedef struct count_variant
+{
+	const char *name;
+	count_func_t func;
+}count_variant_t;
+
+typedef struct mirror_variant
+{
+	const char *name;
+	mirror_func_t func;
+}mirror_variant_t;
+
+static void FillBuffer(bitarray_t *buffer, size_t num_of_words);
+static double NsPerWord(clock_t start, clock_t end);
+static void BenchCount(const bitarray_t *buffer);
+static void BenchMirror(const bitarray_t *buffer);
+
+int main()
+{
+	bitarray_t *buffer = (bitarray_t *)malloc(NUM_OF_WORDS * sizeof(bitarray_t));
+
+	if (NULL == buffer)
+	{
+		return (1);
+	}
+
+	FillBuffer(buffer, NUM_OF_WORDS);
+
+	printf("%d words x %d repeats\n", NUM_OF_WORDS, REPEATS);
+	BenchCount(buffer);
+	BenchMirror(buffer);
+
+	free(buffer);
+
+	return (0);
+}
+
+static void BenchCount(const bitarray_t *buffer)
+{
+	count_variant_t variants[] =
+	{
+		{"BitArrayCountOn", BitArrayCountOn},
+		{"BitArrayCountOnLoop", BitArrayCountOnLoop},
+		{"BitArrayCountOnNoLoop", BitArrayCountOnNoLoop},
+		{"BitArrayCountOnLUT", BitArrayCountOnLUT}
+	};
+	size_t num_of_variants = sizeof(variants) / sizeof(variants[0]);
+	size_t total = 0;
+	clock_t start = 0;
+	size_t i = 0;
+	size_t j = 0;
+	int r = 0;
+
+	for (i = 0; i < num_of_variants; ++i)
+	{
+		total = 0;
+		start = clock();
+
+		for (r = 0; r < REPEATS; ++r)
+		{
+			for (j = 0; j < NUM_OF_WORDS; ++j)
+			{
+				total += variants[i].func(buffer[j]);
+			}
+		}
+
+		printf("%-24s %8.3f ns/word  (%lu)\n", variants[i].name,
+		       NsPerWord(start, clock()), (unsigned long)total);
+	}
+
+	total = 0;
+	start = clock();
+
+	for (r = 0; r < REPEATS; ++r)
+	{
+		total += BitArrayCountOnBulk(buffer, NUM_OF_WORDS);
+	}
+
+	printf("%-24s %8.3f ns/word  (%lu)\n", "BitArrayCountOnBulk",
+	       NsPerWord(start, clock()), (unsigned long)total);
+}
+
+static void BenchMirror(const bitarray_t *buffer)
+{
+	mirror_variant_t variants[] =
+	{
+		{"BitArrayMirror", BitArrayMirror},
+		{"BitArrayMirrorLoop", BitArrayMirrorLoop},
+		{"BitArrayMirrorNoLoop", BitArrayMirrorNoLoop},
+		{"BitArrayMirrorLUT", BitArrayMirrorLUT}
+	};
+	size_t num_of_variants = sizeof(variants) / sizeof(variants[0]);
+	bitarray_t checksum = 0;
+	clock_t start = 0;
+	size_t i = 0;
+	size_t j = 0;
+	int r = 0;
+
+	for (i = 0; i < num_of_variants; ++i)
+	{
+		checksum = 0;
+		start = clock();
+
+		for (r = 0; r < REPEATS; ++r)
+		{
+			for (j = 0; j < NUM_OF_WORDS; ++j)
+			{
+				checksum += variants[i].func(buffer[j]);
+			}
+		}
+
+		printf("%-24s %8.3f ns/word  (%lx)\n", variants[i].name,
+		       NsPerWord(start, clock()), (unsigned long)checksum);
+	}
+}
+
+/* xorshift64, so every run measures the same data */
+static void FillBuffer(bitarray_t *buffer, size_t num_of_words)
+{
+	bitarray_t state = 0x9E3779B97F4A7C15;
+	size_t i = 0;
+
+	for (i = 0; i < num_of_words; ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		buffer[i] = state;
+	}
+}
+
+static double NsPerWord(clock_t start, clock_t end)
+{
+	return ((double)(end - start) / CLOCKS_PER_SEC * NSEC_IN_SEC /
+	        ((double)NUM_OF_WORDS * REPEATS));
+}
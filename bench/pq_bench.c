@@ -0,0 +1,847 @@
+#define _POSIX_C_SOURCE 200112L /* clock_gettime, posix_memalign */
+
+#include <stdio.h>  /* printf */
+#include <stdlib.h> /* malloc, free, qsort, strtoul */
+#include <errno.h>  /* ENOMEM */
+#include <time.h>   /* clock_gettime */
+
+#include "priorityq.h"
+#include "pq_heap.h"
+#include "heap.h"
+#include "key_heap.h"
+#include "radix_heap.h"
+#include "pairing_heap.h"
+#include "multi_pq.h"
+#include "minmax_heap.h"
+
+#define MIN_SIZE 1000
+#define MAX_SIZE 10000000
+#define MIN_OPS (1 << 16)
+#define MAX_OPS (1 << 20)
+#define MAX_SAMPLES (1 << 17)
+#define SAMPLE_EVERY 8
+#define CALIBRATION (1 << 20)
+#define KEY_RANGE (1ul << 24)
+#define LIST_MAX_SIZE 10000
+#define ARITY 4
+#define NUM_OF_QUEUES 4
+#define CANCELS_PER_EXPIRE 3
+#define NOT_LIVE ((size_t)-1)
+#define NSEC_IN_SEC 1000000000ul
+#define SUCCESS 0
+#define FAIL 1
+
+/*
+ * every engine holds item_t pointers and puts the smallest key first.
+ * an engine without erase gets lazy cancellation: the item is dropped from
+ * the live set, and skipped when it later comes out of the queue - which
+ * is how timers are usually cancelled on such a queue
+ */
+typedef struct item
+{
+	unsigned long key;
+	size_t handle;
+	size_t live_index;
+}item_t;
+
+typedef void *(*create_func_t)(size_t capacity);
+typedef void (*destroy_func_t)(void *queue);
+typedef int (*push_func_t)(void *queue, item_t *item);
+typedef item_t *(*pop_func_t)(void *queue);
+typedef void (*erase_func_t)(void *queue, item_t *item);
+
+typedef struct engine
+{
+	const char *name;
+	size_t max_size;
+	create_func_t create;
+	destroy_func_t destroy;
+	push_func_t push;
+	push_func_t push_erasable;
+	pop_func_t pop;
+	erase_func_t erase;
+}engine_t;
+
+/* one timed run of ops operations, a latency sample every stride ops */
+typedef struct phase
+{
+	const char *name;
+	unsigned long start;
+	unsigned long op_start;
+	size_t ops;
+	size_t done;
+	size_t allocs;
+	size_t stride;
+	size_t next_sample;
+	size_t num_of_samples;
+}phase_t;
+
+typedef struct run
+{
+	const engine_t *engine;
+	void *queue;
+	size_t size;
+	item_t *pool;
+	size_t pool_used;
+	item_t **live;
+	size_t num_of_live;
+	unsigned long now;
+	size_t failures;
+	unsigned long *samples;
+	phase_t phase;
+}run_t;
+
+typedef void (*workload_func_t)(run_t *run);
+
+typedef struct workload
+{
+	const char *name;
+	const char *description;
+	workload_func_t func;
+}workload_t;
+
+static void RunWorkload(const engine_t *engine, const workload_t *workload, size_t size);
+static void Hold(run_t *run);
+static void TimerChurn(run_t *run);
+static void MixedErase(run_t *run);
+static void BulkLoadDrain(run_t *run);
+
+static void FillLive(run_t *run);
+static item_t *NewItem(run_t *run, unsigned long key);
+static void Push(run_t *run, item_t *item);
+static void PushLive(run_t *run, item_t *item);
+static item_t *PopLive(run_t *run);
+static void Cancel(run_t *run, item_t *item);
+static void RemoveLive(run_t *run, item_t *item);
+
+static void PhaseStart(run_t *run, const char *name, size_t ops);
+static void PhaseOpStart(run_t *run);
+static void PhaseOpEnd(run_t *run);
+static void PhaseEnd(run_t *run);
+static unsigned long Percentile(const unsigned long *sorted, size_t count, size_t permille);
+static int CompareSamples(const void *sample1, const void *sample2);
+static unsigned long Now(void);
+static void CalibrateClock(void);
+static size_t NumOfOps(size_t size);
+static void Seed(void);
+static unsigned long Random(void);
+
+static int EarlierFirst(const void *item1, const void *item2);
+static int LaterFirst(const void *item1, const void *item2);
+static int IsSameItem(const void *item, const void *param);
+
+static void *ListCreate(size_t capacity);
+static void ListDestroy(void *queue);
+static int ListPush(void *queue, item_t *item);
+static item_t *ListPop(void *queue);
+static void ListErase(void *queue, item_t *item);
+static void *PQCreate(size_t capacity);
+static void *PQStableCreate(size_t capacity);
+static void PQDestroy(void *queue);
+static int PQPush(void *queue, item_t *item);
+static int PQPushHandle(void *queue, item_t *item);
+static item_t *PQPop(void *queue);
+static void PQErase(void *queue, item_t *item);
+static void *DaryCreate(size_t capacity);
+static void DaryDestroy(void *queue);
+static int DaryPush(void *queue, item_t *item);
+static int DaryPushHandle(void *queue, item_t *item);
+static item_t *DaryPop(void *queue);
+static void DaryErase(void *queue, item_t *item);
+static void *KeyCreate(size_t capacity);
+static void KeyDestroy(void *queue);
+static int KeyPush(void *queue, item_t *item);
+static item_t *KeyPop(void *queue);
+static void *RadixCreate(size_t capacity);
+static void RadixDestroy(void *queue);
+static int RadixPush(void *queue, item_t *item);
+static item_t *RadixPop(void *queue);
+static void *PairingCreate(size_t capacity);
+static void PairingDestroy(void *queue);
+static int PairingPush(void *queue, item_t *item);
+static item_t *PairingPop(void *queue);
+static void *MinMaxCreate(size_t capacity);
+static void MinMaxDestroy(void *queue);
+static int MinMaxPush(void *queue, item_t *item);
+static item_t *MinMaxPop(void *queue);
+static void *MultiCreate(size_t capacity);
+static void MultiDestroy(void *queue);
+static int MultiPush(void *queue, item_t *item);
+static item_t *MultiPop(void *queue);
+
+static unsigned long g_random_state = 0;
+static unsigned long g_clock_overhead = 0;
+static size_t g_allocs = 0;
+
+static const engine_t g_engines[] =
+{
+	{"priority_q", LIST_MAX_SIZE, ListCreate, ListDestroy, ListPush, ListPush, ListPop, ListErase},
+	{"pq_heap", MAX_SIZE, PQCreate, PQDestroy, PQPush, PQPushHandle, PQPop, PQErase},
+	{"pq_heap stable", MAX_SIZE, PQStableCreate, PQDestroy, PQPush, PQPushHandle, PQPop, PQErase},
+	{"bin_heap 4-ary", MAX_SIZE, DaryCreate, DaryDestroy, DaryPush, DaryPushHandle, DaryPop, DaryErase},
+	{"key_heap 4-ary", MAX_SIZE, KeyCreate, KeyDestroy, KeyPush, KeyPush, KeyPop, NULL},
+	{"radix_heap", MAX_SIZE, RadixCreate, RadixDestroy, RadixPush, RadixPush, RadixPop, NULL},
+	{"pairing_heap", MAX_SIZE, PairingCreate, PairingDestroy, PairingPush, PairingPush, PairingPop, NULL},
+	{"minmax_heap", MAX_SIZE, MinMaxCreate, MinMaxDestroy, MinMaxPush, MinMaxPush, MinMaxPop, NULL},
+	{"multi_pq x4", MAX_SIZE, MultiCreate, MultiDestroy, MultiPush, MultiPush, MultiPop, NULL}
+};
+
+static const workload_t g_workloads[] =
+{
+	{"hold", "pop the earliest and push it back later, size stays put", Hold},
+	{"timer_churn", "3 of 4 ops cancel a random timer and re-arm it, 1 expires the earliest", TimerChurn},
+	{"mixed_erase", "1 of 2 ops push, 1 of 4 pop the earliest, 1 of 4 erase a random one", MixedErase},
+	{"bulk", "push size random keys into an empty queue, then pop them all", BulkLoadDrain}
+};
+
+/* the allocations the queues make are counted by standing in for malloc.
+   glibc exports its allocator under a second name to forward to */
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+
+void *malloc(size_t size)
+{
+	++g_allocs;
+	return (__libc_malloc(size));
+}
+
+void *calloc(size_t count, size_t size)
+{
+	++g_allocs;
+	return (__libc_calloc(count, size));
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	++g_allocs;
+	return (__libc_realloc(ptr, size));
+}
+
+int posix_memalign(void **memptr, size_t alignment, size_t size)
+{
+	++g_allocs;
+	*memptr = __libc_memalign(alignment, size);
+
+	return ((NULL == *memptr && 0 != size) ? ENOMEM : 0);
+}
+#endif /* __GLIBC__ */
+
+/* usage: bench.out [max_size], sizes go from 1K up to it by 10x */
+int main(int argc, char *argv[])
+{
+	size_t num_of_engines = sizeof(g_engines) / sizeof(g_engines[0]);
+	size_t num_of_workloads = sizeof(g_workloads) / sizeof(g_workloads[0]);
+	size_t max_size = MAX_SIZE;
+	size_t size = 0;
+	size_t i = 0;
+	size_t j = 0;
+
+	if (1 < argc)
+	{
+		max_size = (size_t)strtoul(argv[1], NULL, 10);
+	}
+
+	CalibrateClock();
+
+	printf("%d to %d ops per run, clock read of %lu ns taken off the timed ops\n",
+	       MIN_OPS, MAX_OPS, g_clock_overhead);
+	printf("allocs/op counts malloc, calloc, realloc and posix_memalign calls\n");
+	printf("latency percentiles are in ns, from 1 of every %d ops or more\n", SAMPLE_EVERY);
+	printf("priority_q enqueues in O(n), so it runs up to %d only\n", LIST_MAX_SIZE);
+	printf("engines without erase cancel lazily and skip cancelled items on pop\n");
+
+	for (i = 0; i < num_of_workloads; ++i)
+	{
+		printf("\n%s: %s\n", g_workloads[i].name, g_workloads[i].description);
+		printf("%-16s %-12s %9s %9s %9s %8s %8s %8s %8s\n", "engine", "phase", "size",
+		       "ns/op", "allocs/op", "p50", "p99", "p99.9", "max");
+
+		for (size = MIN_SIZE; size <= max_size; size *= 10)
+		{
+			for (j = 0; j < num_of_engines; ++j)
+			{
+				if (size <= g_engines[j].max_size)
+				{
+					RunWorkload(&g_engines[j], &g_workloads[i], size);
+				}
+			}
+		}
+	}
+
+	return (0);
+}
+
+/* every engine sees the same keys and the same choices for a size */
+static void RunWorkload(const engine_t *engine, const workload_t *workload, size_t size)
+{
+	run_t run = {0};
+	size_t pool_size = size + NumOfOps(size);
+
+	run.engine = engine;
+	run.size = size;
+	run.pool = (item_t *)malloc(pool_size * sizeof(item_t));
+	run.live = (item_t **)malloc(pool_size * sizeof(item_t *));
+	run.samples = (unsigned long *)malloc(MAX_SAMPLES * sizeof(unsigned long));
+	run.queue = engine->create(size);
+
+	if (NULL == run.pool || NULL == run.live || NULL == run.samples || NULL == run.queue)
+	{
+		printf("%-16s %-12s %9lu out of memory\n", engine->name, workload->name,
+		       (unsigned long)size);
+	}
+	else
+	{
+		Seed();
+		workload->func(&run);
+	}
+
+	if (NULL != run.queue)
+	{
+		engine->destroy(run.queue);
+	}
+	free(run.samples);
+	free(run.live);
+	free(run.pool);
+}
+
+/* the classic hold model: an op is a pop and a push of the same item with
+   a later key, the way a discrete event simulation uses its queue */
+static void Hold(run_t *run)
+{
+	item_t *item = NULL;
+	size_t ops = NumOfOps(run->size);
+	size_t i = 0;
+
+	for (i = 0; i < run->size; ++i)
+	{
+		Push(run, NewItem(run, Random() % KEY_RANGE));
+	}
+
+	PhaseStart(run, "hold", ops);
+	for (i = 0; i < ops; ++i)
+	{
+		PhaseOpStart(run);
+		item = run->engine->pop(run->queue);
+		item->key += Random() % KEY_RANGE;
+		Push(run, item);
+		PhaseOpEnd(run);
+	}
+	PhaseEnd(run);
+}
+
+/* size timers stay armed. most are cancelled and re-armed before they
+   fire, as with timeouts that are reset on every bit of activity */
+static void TimerChurn(run_t *run)
+{
+	size_t ops = NumOfOps(run->size);
+	size_t i = 0;
+
+	FillLive(run);
+
+	PhaseStart(run, "timer_churn", ops);
+	for (i = 0; i < ops; ++i)
+	{
+		PhaseOpStart(run);
+		if (0 != Random() % (CANCELS_PER_EXPIRE + 1))
+		{
+			Cancel(run, run->live[Random() % run->num_of_live]);
+		}
+		else
+		{
+			PopLive(run);
+		}
+		PushLive(run, NewItem(run, run->now + Random() % KEY_RANGE));
+		PhaseOpEnd(run);
+	}
+	PhaseEnd(run);
+}
+
+/* pushes balance pops and erases, so the size drifts around its start */
+static void MixedErase(run_t *run)
+{
+	size_t ops = NumOfOps(run->size);
+	size_t i = 0;
+
+	FillLive(run);
+
+	PhaseStart(run, "mixed_erase", ops);
+	for (i = 0; i < ops; ++i)
+	{
+		PhaseOpStart(run);
+		switch (Random() % 4)
+		{
+			case 0:
+			case 1:
+				PushLive(run, NewItem(run, run->now + Random() % KEY_RANGE));
+				break;
+
+			case 2:
+				if (0 != run->num_of_live)
+				{
+					PopLive(run);
+				}
+				break;
+
+			default:
+				if (0 != run->num_of_live)
+				{
+					Cancel(run, run->live[Random() % run->num_of_live]);
+				}
+				break;
+		}
+		PhaseOpEnd(run);
+	}
+	PhaseEnd(run);
+}
+
+static void BulkLoadDrain(run_t *run)
+{
+	size_t i = 0;
+
+	for (i = 0; i < run->size; ++i)
+	{
+		NewItem(run, Random() % KEY_RANGE);
+	}
+
+	PhaseStart(run, "bulk_load", run->size);
+	for (i = 0; i < run->size; ++i)
+	{
+		PhaseOpStart(run);
+		Push(run, &run->pool[i]);
+		PhaseOpEnd(run);
+	}
+	PhaseEnd(run);
+
+	PhaseStart(run, "drain", run->size);
+	for (i = 0; i < run->size; ++i)
+	{
+		PhaseOpStart(run);
+		run->engine->pop(run->queue);
+		PhaseOpEnd(run);
+	}
+	PhaseEnd(run);
+}
+
+static void FillLive(run_t *run)
+{
+	size_t i = 0;
+
+	for (i = 0; i < run->size; ++i)
+	{
+		PushLive(run, NewItem(run, Random() % KEY_RANGE));
+	}
+}
+
+/* the pool holds an item for every push a run can make, so no item is
+   allocated while timing */
+static item_t *NewItem(run_t *run, unsigned long key)
+{
+	item_t *item = &run->pool[run->pool_used++];
+
+	item->key = key;
+	item->handle = 0;
+	item->live_index = NOT_LIVE;
+
+	return (item);
+}
+
+static void Push(run_t *run, item_t *item)
+{
+	run->failures += (SUCCESS != run->engine->push(run->queue, item));
+}
+
+static void PushLive(run_t *run, item_t *item)
+{
+	run->failures += (SUCCESS != run->engine->push_erasable(run->queue, item));
+
+	item->live_index = run->num_of_live;
+	run->live[run->num_of_live++] = item;
+}
+
+/* pops until a live item comes out, so lazily cancelled ones are paid for
+   here. there is a live item, so the queue cannot run out first */
+static item_t *PopLive(run_t *run)
+{
+	item_t *item = NULL;
+
+	do
+	{
+		item = run->engine->pop(run->queue);
+		if (run->now < item->key)
+		{
+			run->now = item->key;
+		}
+	}
+	while (NOT_LIVE == item->live_index);
+
+	RemoveLive(run, item);
+
+	return (item);
+}
+
+static void Cancel(run_t *run, item_t *item)
+{
+	RemoveLive(run, item);
+
+	if (NULL != run->engine->erase)
+	{
+		run->engine->erase(run->queue, item);
+	}
+}
+
+static void RemoveLive(run_t *run, item_t *item)
+{
+	item_t *last = run->live[--run->num_of_live];
+
+	run->live[item->live_index] = last;
+	last->live_index = item->live_index;
+	item->live_index = NOT_LIVE;
+}
+
+static void PhaseStart(run_t *run, const char *name, size_t ops)
+{
+	phase_t *phase = &run->phase;
+
+	phase->name = name;
+	phase->ops = ops;
+	phase->done = 0;
+	phase->stride = (ops / MAX_SAMPLES > SAMPLE_EVERY) ? ops / MAX_SAMPLES + 1 : SAMPLE_EVERY;
+	phase->next_sample = 0;
+	phase->num_of_samples = 0;
+	run->failures = 0;
+
+	phase->allocs = g_allocs;
+	phase->start = Now();
+}
+
+/* only every stride-th op is timed, so the clock reads do not swamp ops
+   that cost about as much as a read */
+static void PhaseOpStart(run_t *run)
+{
+	phase_t *phase = &run->phase;
+
+	if (phase->done == phase->next_sample)
+	{
+		phase->op_start = Now();
+	}
+}
+
+static void PhaseOpEnd(run_t *run)
+{
+	phase_t *phase = &run->phase;
+
+	if (phase->done == phase->next_sample)
+	{
+		run->samples[phase->num_of_samples++] = Now() - phase->op_start;
+		phase->next_sample += phase->stride;
+	}
+	++phase->done;
+}
+
+/* a timed op read the clock twice, once inside its sample */
+static void PhaseEnd(run_t *run)
+{
+	phase_t *phase = &run->phase;
+	size_t allocs = g_allocs - phase->allocs;
+	double elapsed = (double)(Now() - phase->start) -
+	                 2.0 * g_clock_overhead * phase->num_of_samples;
+	double ns_per_op = elapsed / phase->ops;
+
+	qsort(run->samples, phase->num_of_samples, sizeof(unsigned long), CompareSamples);
+
+	printf("%-16s %-12s %9lu %9.1f %9.3f %8lu %8lu %8lu %8lu%s\n",
+	       run->engine->name, phase->name, (unsigned long)run->size,
+	       (0.0 < ns_per_op) ? ns_per_op : 0.0, (double)allocs / phase->ops,
+	       Percentile(run->samples, phase->num_of_samples, 500),
+	       Percentile(run->samples, phase->num_of_samples, 990),
+	       Percentile(run->samples, phase->num_of_samples, 999),
+	       Percentile(run->samples, phase->num_of_samples, 1000),
+	       (0 != run->failures) ? "  push FAILED" : "");
+}
+
+static unsigned long Percentile(const unsigned long *sorted, size_t count, size_t permille)
+{
+	unsigned long sample = sorted[(count - 1) * permille / 1000];
+
+	return ((g_clock_overhead < sample) ? sample - g_clock_overhead : 0);
+}
+
+static int CompareSamples(const void *sample1, const void *sample2)
+{
+	unsigned long value1 = *(const unsigned long *)sample1;
+	unsigned long value2 = *(const unsigned long *)sample2;
+
+	return ((value1 > value2) - (value1 < value2));
+}
+
+static unsigned long Now(void)
+{
+	struct timespec now = {0};
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return ((unsigned long)now.tv_sec * NSEC_IN_SEC + (unsigned long)now.tv_nsec);
+}
+
+/* every tick reads the clock once, so that much is taken off every op */
+static void CalibrateClock(void)
+{
+	unsigned long start = Now();
+	size_t i = 0;
+
+	for (i = 0; i < CALIBRATION; ++i)
+	{
+		Now();
+	}
+
+	g_clock_overhead = (Now() - start) / CALIBRATION;
+}
+
+static size_t NumOfOps(size_t size)
+{
+	return ((size < MIN_OPS) ? MIN_OPS : (size > MAX_OPS) ? MAX_OPS : size);
+}
+
+static void Seed(void)
+{
+	g_random_state = 0x9E3779B97F4A7C15ul;
+}
+
+/* xorshift64, so every run measures the same data */
+static unsigned long Random(void)
+{
+	g_random_state ^= g_random_state << 13;
+	g_random_state ^= g_random_state >> 7;
+	g_random_state ^= g_random_state << 17;
+
+	return (g_random_state);
+}
+
+/*=============================== ENGINES ===================================*/
+
+static int EarlierFirst(const void *item1, const void *item2)
+{
+	unsigned long key1 = ((const item_t *)item1)->key;
+	unsigned long key2 = ((const item_t *)item2)->key;
+
+	return ((key1 < key2) - (key1 > key2));
+}
+
+static int LaterFirst(const void *item1, const void *item2)
+{
+	return (EarlierFirst(item2, item1));
+}
+
+static int IsSameItem(const void *item, const void *param)
+{
+	return (item == param);
+}
+
+static void *ListCreate(size_t capacity)
+{
+	(void)capacity;
+	return (PriorityQCreate(EarlierFirst));
+}
+
+static void ListDestroy(void *queue)
+{
+	PriorityQDestroy((priority_q_t *)queue);
+}
+
+/* PriorityQEnqueue returns 1 for success */
+static int ListPush(void *queue, item_t *item)
+{
+	return (PriorityQEnqueue((priority_q_t *)queue, item) ? SUCCESS : FAIL);
+}
+
+static item_t *ListPop(void *queue)
+{
+	return ((item_t *)PriorityQDequeue((priority_q_t *)queue));
+}
+
+static void ListErase(void *queue, item_t *item)
+{
+	PriorityQErase((priority_q_t *)queue, IsSameItem, item);
+}
+
+static void *PQCreate(size_t capacity)
+{
+	(void)capacity;
+	return (PQHeapCreate(EarlierFirst));
+}
+
+static void *PQStableCreate(size_t capacity)
+{
+	(void)capacity;
+	return (PQHeapCreateStable(EarlierFirst));
+}
+
+static void PQDestroy(void *queue)
+{
+	PQHeapDestroy((pq_heap_t *)queue);
+}
+
+static int PQPush(void *queue, item_t *item)
+{
+	return (PQHeapEnqueue((pq_heap_t *)queue, item));
+}
+
+static int PQPushHandle(void *queue, item_t *item)
+{
+	return (PQHeapEnqueueHandle((pq_heap_t *)queue, item, &item->handle));
+}
+
+static item_t *PQPop(void *queue)
+{
+	return ((item_t *)PQHeapDequeue((pq_heap_t *)queue));
+}
+
+static void PQErase(void *queue, item_t *item)
+{
+	PQHeapEraseHandle((pq_heap_t *)queue, item->handle);
+}
+
+static void *DaryCreate(size_t capacity)
+{
+	(void)capacity;
+	return (BinHeapCreateDary(EarlierFirst, ARITY));
+}
+
+static void DaryDestroy(void *queue)
+{
+	BinHeapDestroy((bin_heap_t *)queue);
+}
+
+static int DaryPush(void *queue, item_t *item)
+{
+	return (BinHeapPush((bin_heap_t *)queue, item));
+}
+
+static int DaryPushHandle(void *queue, item_t *item)
+{
+	return (BinHeapPushHandle((bin_heap_t *)queue, item, &item->handle));
+}
+
+static item_t *DaryPop(void *queue)
+{
+	item_t *item = (item_t *)BinHeapPeek((bin_heap_t *)queue);
+
+	BinHeapPop((bin_heap_t *)queue);
+
+	return (item);
+}
+
+static void DaryErase(void *queue, item_t *item)
+{
+	BinHeapRemoveHandle((bin_heap_t *)queue, item->handle);
+}
+
+static void *KeyCreate(size_t capacity)
+{
+	return (KeyHeapCreate(ARITY, capacity));
+}
+
+static void KeyDestroy(void *queue)
+{
+	KeyHeapDestroy((key_heap_t *)queue);
+}
+
+static int KeyPush(void *queue, item_t *item)
+{
+	return (KeyHeapPush((key_heap_t *)queue, item->key, item));
+}
+
+static item_t *KeyPop(void *queue)
+{
+	return ((item_t *)KeyHeapPop((key_heap_t *)queue));
+}
+
+static void *RadixCreate(size_t capacity)
+{
+	(void)capacity;
+	return (RadixHeapCreate());
+}
+
+static void RadixDestroy(void *queue)
+{
+	RadixHeapDestroy((radix_heap_t *)queue);
+}
+
+static int RadixPush(void *queue, item_t *item)
+{
+	return (RadixHeapEnqueue((radix_heap_t *)queue, item->key, item));
+}
+
+static item_t *RadixPop(void *queue)
+{
+	return ((item_t *)RadixHeapDequeue((radix_heap_t *)queue));
+}
+
+static void *PairingCreate(size_t capacity)
+{
+	(void)capacity;
+	return (PairingHeapCreate(EarlierFirst));
+}
+
+static void PairingDestroy(void *queue)
+{
+	PairingHeapDestroy((pairing_heap_t *)queue);
+}
+
+static int PairingPush(void *queue, item_t *item)
+{
+	return (PairingHeapPush((pairing_heap_t *)queue, item));
+}
+
+static item_t *PairingPop(void *queue)
+{
+	return ((item_t *)PairingHeapPop((pairing_heap_t *)queue));
+}
+
+/* ordered by key as it is, so the earliest is the min end */
+static void *MinMaxCreate(size_t capacity)
+{
+	(void)capacity;
+	return (MinMaxHeapCreate(LaterFirst));
+}
+
+static void MinMaxDestroy(void *queue)
+{
+	MinMaxHeapDestroy((minmax_heap_t *)queue);
+}
+
+static int MinMaxPush(void *queue, item_t *item)
+{
+	return (MinMaxHeapPush((minmax_heap_t *)queue, item));
+}
+
+static item_t *MinMaxPop(void *queue)
+{
+	return ((item_t *)MinMaxHeapPopMin((minmax_heap_t *)queue));
+}
+
+/* run from a single thread here, so this is the cost of the locks and of
+   spreading over several heaps with no contention to win back */
+static void *MultiCreate(size_t capacity)
+{
+	(void)capacity;
+	return (MultiPQCreate(EarlierFirst, NUM_OF_QUEUES));
+}
+
+static void MultiDestroy(void *queue)
+{
+	MultiPQDestroy((multi_pq_t *)queue);
+}
+
+static int MultiPush(void *queue, item_t *item)
+{
+	return (MultiPQEnqueue((multi_pq_t *)queue, item));
+}
+
+static item_t *MultiPop(void *queue)
+{
+	return ((item_t *)MultiPQDequeue((multi_pq_t *)queue));
+}
@@ -13,6 +13,21 @@ typedef int (*cmp_func_t)(const void *data1, const void *data2);
 
 typedef struct avl avl_t;
 
+/* an avl never gets deeper than this, see source/avl.c */
+#define AVL_ITER_DEPTH 96
+
+/*
+ * an in order position in an avl. the fields are private - the iterator
+ * holds the path from the root to its element, so it needs no parent links
+ * in the nodes. any insert or remove invalidates all iterators of the avl.
+ */
+typedef struct avl_iter
+{
+	const avl_t *tree;
+	size_t depth;
+	const void *path[AVL_ITER_DEPTH];
+}avl_iter_t;
+
 typedef enum traverse
 {
     PRE_ORDER,
@@ -35,6 +50,24 @@ typedef enum traverse
  */
 avl_t *AVLCreate(cmp_func_t cmp_func);
 
+/* DESCRIPTION:
+ * Function creates a perfectly balanced avl out of elements that are
+ * already sorted according to cmp_func, without comparing them
+ *
+ * PARAMS:
+ * cmp_func - pointer to the compare function
+ * elements - the sorted elements
+ * count    - number of elements
+ *         
+ * RETURN:
+ * Returns a pointer to the created avl, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(log n)
+ */
+avl_t *AVLCreateFromSorted(cmp_func_t cmp_func, void *elements[], size_t count);
+
 /* DESCRIPTION:
  * Function destroys and performs cleanup on the given avl.
  * passing an invalid avl pointer would result in undefined behaviour
@@ -129,7 +162,7 @@ void *AVLFind(const avl_t *tree, const void *key);
  * number of elements
  *
  * COMPLEXITY:
- * time: O(n) 
+ * time: O(1) 
  * space: O(1)
  */
 size_t AVLSize(const avl_t *tree);
@@ -166,4 +199,235 @@ int AVLForEach(avl_t *tree, action_func_t action_func, void *param, traverse_t t
  */
 size_t AVLHeight(const avl_t *tree);
 
+/* DESCRIPTION:
+ * Function finds the k-th smallest element, counting from 0, so
+ * AVLSelect(tree, AVLSize(tree) / 2) is the median.
+ * passing an invalid avl would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - pointer to the avl
+ * k    - number of smaller elements the wanted element has
+ *         
+ * RETURN:
+ * the k-th element, NULL if k is not smaller than the size of the avl
+ *
+ * COMPLEXITY:
+ * time: O(log n) 
+ * space: O(1)
+ */
+void *AVLSelect(const avl_t *tree, size_t k);
+
+/* DESCRIPTION:
+ * Function counts the elements smaller than key. key does not have to be
+ * in the avl, and when it is AVLSelect(tree, AVLRank(tree, key)) finds it.
+ * passing an invalid avl would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - pointer to the avl
+ * key  - key to rank
+ *         
+ * RETURN:
+ * number of elements smaller than key
+ *
+ * COMPLEXITY:
+ * time: O(log n) 
+ * space: O(1)
+ */
+size_t AVLRank(const avl_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function finds the smallest element that is not smaller than key.
+ * passing an invalid avl would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - pointer to the avl
+ * key  - key to search from
+ *         
+ * RETURN:
+ * the found element, NULL if all the elements are smaller than key
+ *
+ * COMPLEXITY:
+ * time: O(log n) 
+ * space: O(1)
+ */
+void *AVLLowerBound(const avl_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function finds the smallest element that is bigger than key.
+ * passing an invalid avl would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - pointer to the avl
+ * key  - key to search from
+ *         
+ * RETURN:
+ * the found element, NULL if no element is bigger than key
+ *
+ * COMPLEXITY:
+ * time: O(log n) 
+ * space: O(1)
+ */
+void *AVLUpperBound(const avl_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function performs an action on each element in [from, to) in ascending
+ * order, and stops at the first action that does not return 0.
+ * the action must not change the order of the elements.
+ * passing an invalid avl would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree         - pointer to the avl tree
+ * from         - key of the start of the range, included
+ * to           - key of the end of the range, excluded
+ * action_func  - function pointer to an action to perform on an element
+ * param        - element for action function
+ *      
+ * RETURN:
+ * 0 if success, 1 if an action failed
+ *
+ * COMPLEXITY:
+ * time: O(log n + k), k - number of elements in the range
+ * space: O(1)
+ */
+int AVLForEachRange(avl_t *tree, const void *from, const void *to,
+                    action_func_t action_func, void *param);
+
+/* DESCRIPTION:
+ * Function joins pivot and all the elements of right into left. every
+ * element of left must be smaller than pivot, and pivot must not be bigger
+ * than any element of right. right is left empty and still has to be
+ * destroyed.
+ * passing an invalid avl would result in undefined behaviour.
+ *
+ * PARAMS:
+ * left  - avl of the smaller elements, receives the result
+ * pivot - element that separates the two avls
+ * right - avl of the bigger elements
+ *         
+ * RETURN:
+ * 0 for success, 1 if allocation failed - both avls are then unchanged
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+int AVLJoin(avl_t *left, void *pivot, avl_t *right);
+
+/* DESCRIPTION:
+ * Function moves every element that is not smaller than key from tree to
+ * right. right must be empty and use the same compare function.
+ * passing an invalid avl would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree  - avl to split, keeps the elements smaller than key
+ * key   - key to split at
+ * right - empty avl, receives the rest of the elements
+ *         
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void AVLSplit(avl_t *tree, const void *key, avl_t *right);
+
+/* DESCRIPTION:
+ * Function sets iter to the smallest element of the avl, or to the end if
+ * the avl is empty
+ *
+ * PARAMS:
+ * tree - pointer to the avl
+ * iter - iterator to set
+ *         
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void AVLIterBegin(const avl_t *tree, avl_iter_t *iter);
+
+/* DESCRIPTION:
+ * Function sets iter to the end of the avl. the end lies past the biggest
+ * element and before the smallest one, so AVLIterPrev from the end gives the
+ * biggest element and AVLIterNext gives the smallest.
+ *
+ * PARAMS:
+ * tree - pointer to the avl
+ * iter - iterator to set
+ *         
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void AVLIterEnd(const avl_t *tree, avl_iter_t *iter);
+
+/* DESCRIPTION:
+ * Function moves iter to the next bigger element, or to the end after the
+ * biggest one
+ *
+ * PARAMS:
+ * iter - iterator to move
+ *         
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: amortized O(1), worst O(log n)
+ * space: O(1)
+ */
+void AVLIterNext(avl_iter_t *iter);
+
+/* DESCRIPTION:
+ * Function moves iter to the next smaller element, or to the end before the
+ * smallest one
+ *
+ * PARAMS:
+ * iter - iterator to move
+ *         
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: amortized O(1), worst O(log n)
+ * space: O(1)
+ */
+void AVLIterPrev(avl_iter_t *iter);
+
+/* DESCRIPTION:
+ * Function checks whether iter is at the end of its avl
+ *
+ * PARAMS:
+ * iter - iterator to check
+ *         
+ * RETURN:
+ * 1 at the end, 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int AVLIterIsEnd(const avl_iter_t *iter);
+
+/* DESCRIPTION:
+ * Function returns the element iter is at.
+ * calling it on the end would result in undefined behaviour.
+ *
+ * PARAMS:
+ * iter - iterator to read
+ *         
+ * RETURN:
+ * the element
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *AVLIterGetData(const avl_iter_t *iter);
+
 #endif /* __AVL_H__ */
@@ -0,0 +1,201 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _AVL_ARENA_H_
+#define _AVL_ARENA_H_
+
+#include <stddef.h> /* size_t */
+
+typedef int (*action_func_t)(void *data, void *param);
+typedef int (*cmp_func_t)(const void *data1, const void *data2);
+
+typedef struct avl_arena avl_arena_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct avl_arena
+ * {
+ *		avl_arena_node_t *nodes;
+ *		uint32_t capacity;
+ *		uint32_t next_unused;
+ *		uint32_t free_list;
+ *		uint32_t root;
+ *		cmp_func_t cmp_func;
+ * }
+ *
+ * same tree as avl_t, but all the nodes live in one growing array and link
+ * to each other by 32 bit index instead of by pointer, with a 1 byte height.
+ * a node takes 24 bytes (avl_t: 40 bytes plus malloc's own overhead), nodes
+ * allocated together sit together in memory, and destroying the tree is a
+ * single free no matter how many elements it holds.
+ * holds up to 2^32 - 2 elements.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty tree
+ *
+ * PARAMS:
+ * cmp_func - pointer to the compare function
+ * capacity - number of elements to reserve room for, the tree grows past it
+ *            when needed
+ *
+ * RETURN:
+ * Returns a pointer to the created tree, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(capacity)
+ */
+avl_arena_t *AVLArenaCreate(cmp_func_t cmp_func, size_t capacity);
+
+/* DESCRIPTION:
+ * Function destroys the tree and all its nodes at once, but not the stored
+ * elements
+ * passing an invalid tree pointer would result in undefined behaviour
+ *
+ * PARAMS:
+ * tree - pointer to the tree to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void AVLArenaDestroy(avl_arena_t *tree);
+
+/* DESCRIPTION:
+ * Function removes all the elements, keeping the memory for reuse
+ *
+ * PARAMS:
+ * tree - pointer to the tree to clear
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void AVLArenaClear(avl_arena_t *tree);
+
+/* DESCRIPTION:
+ * Function inserts the given element to the tree.
+ * passing an invalid tree would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - tree to insert the data to
+ * data - the data to insert
+ *
+ * RETURN:
+ * 0 for success, 1 if the tree could not grow
+ *
+ * COMPLEXITY:
+ * time: O(log n), amortized over the growth of the array
+ * space: O(1)
+ */
+int AVLArenaInsert(avl_arena_t *tree, void *data);
+
+/* DESCRIPTION:
+ * Function removes an element matching key from the tree, if there is one
+ * passing an invalid tree would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - tree to remove from
+ * key  - key to find the element to remove
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void AVLArenaRemove(avl_arena_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function finds an element matching key
+ *
+ * PARAMS:
+ * tree - tree to search in
+ * key  - key to look for
+ *
+ * RETURN:
+ * the matching element, NULL if not found
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void *AVLArenaFind(const avl_arena_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the tree
+ *
+ * PARAMS:
+ * tree - pointer to the tree
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t AVLArenaSize(const avl_arena_t *tree);
+
+/* DESCRIPTION:
+ * Function checks whether the tree is empty
+ *
+ * PARAMS:
+ * tree - pointer to the tree
+ *
+ * RETURN:
+ * 1 if the tree is empty or 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int AVLArenaIsEmpty(const avl_arena_t *tree);
+
+/* DESCRIPTION:
+ * Function checks the tree's height.
+ *
+ * PARAMS:
+ * tree - pointer to the tree to check height
+ *
+ * RETURN:
+ * The tree's height - leaf height is 1.
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t AVLArenaHeight(const avl_arena_t *tree);
+
+/* DESCRIPTION:
+ * Function performs an action on each element in ascending order, and stops
+ * at the first action that does not return 0.
+ * the action must not change the order of the elements
+ *
+ * PARAMS:
+ * tree         - pointer to the tree
+ * action_func  - function pointer to an action to perform on an element
+ * param        - element for action function
+ *
+ * RETURN:
+ * 0 if success, 1 if an action failed
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(1)
+ */
+int AVLArenaForEach(avl_arena_t *tree, action_func_t action_func, void *param);
+
+#endif /* _AVL_ARENA_H_ */
@@ -0,0 +1,202 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _AVL_PERSIST_H_
+#define _AVL_PERSIST_H_
+
+#include <stddef.h> /* size_t */
+
+typedef int (*action_func_t)(void *data, void *param);
+typedef int (*cmp_func_t)(const void *data1, const void *data2);
+
+typedef struct avl_persist avl_persist_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct avl_persist
+ * {
+ *		avl_persist_node_t *root;
+ *		cmp_func_t cmp_func;
+ *		avl_persist_node_t *spares;
+ *		size_t num_spares;
+ * }
+ *
+ * a persistent avl: nodes are never changed once built. insert and remove
+ * copy only the path from the root to the change (and the few nodes a
+ * rotation touches) and share every other subtree with the old version.
+ * an avl_persist_t is a handle to one version; a snapshot is a second
+ * handle to the same version, taken in O(1), that later changes through
+ * the first handle do not affect.
+ * nodes count the links to them (atomically) and are freed when the last
+ * version using them is gone, so different handles may be used and
+ * destroyed by different threads at the same time without locking.
+ * a single handle must not be used by two threads at once.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty tree
+ *
+ * PARAMS:
+ * cmp_func - pointer to the compare function
+ *
+ * RETURN:
+ * Returns a pointer to the created tree, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+avl_persist_t *AVLPersistCreate(cmp_func_t cmp_func);
+
+/* DESCRIPTION:
+ * Function destroys the handle, and the nodes of its version that no other
+ * handle still uses. the stored elements are not freed.
+ * passing an invalid tree pointer would result in undefined behaviour
+ *
+ * PARAMS:
+ * tree - pointer to the tree to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(number of nodes freed)
+ * space: O(1)
+ */
+void AVLPersistDestroy(avl_persist_t *tree);
+
+/* DESCRIPTION:
+ * Function returns a new handle to the current version of tree. later
+ * changes through either handle are not seen through the other one.
+ * the snapshot must be destroyed on its own.
+ *
+ * PARAMS:
+ * tree - pointer to the tree to take a snapshot of
+ *
+ * RETURN:
+ * Returns a pointer to the snapshot, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+avl_persist_t *AVLPersistSnapshot(const avl_persist_t *tree);
+
+/* DESCRIPTION:
+ * Function inserts the given element, making a new version for the handle
+ *
+ * PARAMS:
+ * tree - tree to insert the data to
+ * data - the data to insert
+ *
+ * RETURN:
+ * 0 for success, 1 if allocation failed - the tree is then unchanged
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(log n)
+ */
+int AVLPersistInsert(avl_persist_t *tree, void *data);
+
+/* DESCRIPTION:
+ * Function removes the element matching key, making a new version for the
+ * handle. does nothing if there is no such element.
+ *
+ * PARAMS:
+ * tree - tree to remove from
+ * key  - key to find the element to remove
+ *
+ * RETURN:
+ * 0 for success, 1 if allocation failed - the tree is then unchanged
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(log n)
+ */
+int AVLPersistRemove(avl_persist_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function finds the element matching key
+ *
+ * PARAMS:
+ * tree - tree to search in
+ * key  - key to look for
+ *
+ * RETURN:
+ * the matching element, NULL if not found
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void *AVLPersistFind(const avl_persist_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the tree
+ *
+ * PARAMS:
+ * tree - pointer to the tree
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t AVLPersistSize(const avl_persist_t *tree);
+
+/* DESCRIPTION:
+ * Function checks if the tree is empty
+ *
+ * PARAMS:
+ * tree - pointer to the tree
+ *
+ * RETURN:
+ * 1 if empty, 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int AVLPersistIsEmpty(const avl_persist_t *tree);
+
+/* DESCRIPTION:
+ * Function returns the height of the tree, 0 when empty
+ *
+ * PARAMS:
+ * tree - pointer to the tree
+ *
+ * RETURN:
+ * height of the tree
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t AVLPersistHeight(const avl_persist_t *tree);
+
+/* DESCRIPTION:
+ * Function performs action_func on each element in order, and stops at the
+ * first one that fails. the elements are shared with other versions, so
+ * action_func must not change their keys.
+ *
+ * PARAMS:
+ * tree        - pointer to the tree
+ * action_func - function to perform on each element
+ * param       - parameter for action_func
+ *
+ * RETURN:
+ * 0 if all succeeded, 1 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(1)
+ */
+int AVLPersistForEach(const avl_persist_t *tree, action_func_t action_func, void *param);
+
+#endif /* _AVL_PERSIST_H_ */
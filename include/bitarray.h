@@ -71,6 +71,9 @@ bitarray_t BitArrayRotR(bitarray_t arr, size_t num_of_rotations);
 
 /* DESCRIPTION:
  * This function count all the bits that are set
+ * BitArrayCountOn uses the popcnt instruction when the CPU supports it,
+ * chosen once at runtime, and falls back to BitArrayCountOnNoLoop.
+ * the other versions are kept for comparison
  *
  * PARAMS:
  * arr - bitarray to calculate set on bits
@@ -79,10 +82,27 @@ bitarray_t BitArrayRotR(bitarray_t arr, size_t num_of_rotations);
  * number of bits on in a given array
  */
 size_t BitArrayCountOn(bitarray_t arr);
+size_t BitArrayCountOnLoop(bitarray_t arr);
 size_t BitArrayCountOnNoLoop(bitarray_t arr);
 size_t BitArrayCountOnLUT(bitarray_t arr);
 
 
+
+/* DESCRIPTION:
+ * This function count all the bits that are set in an array of bitarrays
+ * uses AVX-512 VPOPCNTQ, AVX2 or popcnt, whichever is the fastest the CPU
+ * supports, chosen once at runtime
+ *
+ * PARAMS:
+ * arr          - bitarrays to calculate set on bits
+ * num_of_words - number of bitarrays in arr
+ * 
+ * RETURN:
+ * number of bits on in all the given arrays
+ */
+size_t BitArrayCountOnBulk(const bitarray_t *arr, size_t num_of_words);
+
+
 /* DESCRIPTION:
  * This function reset all the bits
  *
@@ -190,6 +210,9 @@ bitarray_t BitArraySetBit(bitarray_t arr,size_t index, int value);
 
 /* DESCRIPTION:
  * This function mirrors the entire bitarray
+ * BitArrayMirror reverses the bytes with the compiler's byte swap builtin
+ * and then the bits inside each byte. the other versions are kept for
+ * comparison
  *
  * PARAMS:
  * arr - the bitarray to mirror
@@ -198,6 +221,7 @@ bitarray_t BitArraySetBit(bitarray_t arr,size_t index, int value);
  * mirrored bitarray
  */
 bitarray_t BitArrayMirror(bitarray_t arr);
+bitarray_t BitArrayMirrorLoop(bitarray_t arr);
 bitarray_t BitArrayMirrorNoLoop(bitarray_t arr);
 bitarray_t BitArrayMirrorLUT(bitarray_t arr);
 
@@ -0,0 +1,210 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef __BITVECTOR_H__
+#define __BITVECTOR_H__
+
+#include <stddef.h> /* size_t */
+
+#include "bitarray.h"
+
+struct bitvector;
+
+typedef struct bitvector *bitvector_ptr_t;
+typedef struct bitvector bitvector_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct bitvector
+ * {
+ *		bitarray_t *words;
+ *		size_t num_of_bits;
+ *		size_t num_of_words;
+ * }
+ *
+ * bits are stored little endian inside each bitarray_t word, so bit i lives
+ * in words[i / 64] at index i % 64. bits past num_of_bits are kept off.
+ * ranges are given as [from, to) - from included, to excluded.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates a bit vector with all bits off
+ *
+ * PARAMS:
+ * num_of_bits - number of bits in the vector
+ *
+ * RETURN:
+ * Returns a pointer to the new vector, or NULL on error
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(n)
+ */
+bitvector_ptr_t BitVectorCreate(size_t num_of_bits);
+
+/* DESCRIPTION:
+ * Function destroys and performs cleanup on the given vector
+ * passing an invalid vector pointer would result in undefined behaviour
+ *
+ * PARAMS:
+ * vector - pointer to the vector to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void BitVectorDestroy(bitvector_ptr_t vector);
+
+/* DESCRIPTION:
+ * Function changes the number of bits in the vector.
+ * bits added at the end are off; on failure the vector is left unchanged
+ *
+ * PARAMS:
+ * vector      - pointer to the vector to resize
+ * num_of_bits - new number of bits
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL
+ *
+ * COMPLEXITY:
+ * time: best - O(1), worst - O(n)
+ * space: O(n)
+ */
+int BitVectorResize(bitvector_ptr_t vector, size_t num_of_bits);
+
+/* DESCRIPTION:
+ * Function returns the number of bits in the vector
+ *
+ * PARAMS:
+ * vector - pointer to the vector
+ *
+ * RETURN:
+ * number of bits
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t BitVectorSize(const bitvector_ptr_t vector);
+
+/* DESCRIPTION:
+ * Function returns a read only view of the words backing the vector, for
+ * structures built on top of it. bits past BitVectorSize are off.
+ * the view is invalidated by BitVectorResize
+ *
+ * PARAMS:
+ * vector - pointer to the vector
+ *
+ * RETURN:
+ * pointer to the first of the vector's words
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+const bitarray_t *BitVectorGetWords(const bitvector_ptr_t vector);
+
+/* DESCRIPTION:
+ * Functions get, set on, set off and flip a single bit
+ * out of range index would result in undefined behaviour
+ *
+ * PARAMS:
+ * vector - pointer to the vector
+ * index  - index of the bit
+ *
+ * RETURN:
+ * BitVectorGetVal - value of the bit (0 or 1)
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int BitVectorGetVal(const bitvector_ptr_t vector, size_t index);
+void BitVectorSetOn(bitvector_ptr_t vector, size_t index);
+void BitVectorSetOff(bitvector_ptr_t vector, size_t index);
+void BitVectorFlip(bitvector_ptr_t vector, size_t index);
+
+/* DESCRIPTION:
+ * Functions set on, set off and flip every bit in [from, to)
+ * from > to or to > BitVectorSize would result in undefined behaviour
+ *
+ * PARAMS:
+ * vector - pointer to the vector
+ * from   - index of the first bit in the range
+ * to     - index past the last bit in the range
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(n) in words
+ * space: O(1)
+ */
+void BitVectorSetRangeOn(bitvector_ptr_t vector, size_t from, size_t to);
+void BitVectorSetRangeOff(bitvector_ptr_t vector, size_t from, size_t to);
+void BitVectorFlipRange(bitvector_ptr_t vector, size_t from, size_t to);
+
+/* DESCRIPTION:
+ * Function counts the bits that are on in [from, to)
+ * from > to or to > BitVectorSize would result in undefined behaviour
+ *
+ * PARAMS:
+ * vector - pointer to the vector
+ * from   - index of the first bit in the range
+ * to     - index past the last bit in the range
+ *
+ * RETURN:
+ * number of bits on in the range
+ *
+ * COMPLEXITY:
+ * time: O(n) in words
+ * space: O(1)
+ */
+size_t BitVectorCountOn(const bitvector_ptr_t vector, size_t from, size_t to);
+
+/* DESCRIPTION:
+ * Functions find the first bit that is on / off at or after from
+ *
+ * PARAMS:
+ * vector - pointer to the vector
+ * from   - index to start searching from
+ *
+ * RETURN:
+ * index of the found bit, or BitVectorSize if there is none
+ *
+ * COMPLEXITY:
+ * time: O(n) in words
+ * space: O(1)
+ */
+size_t BitVectorFindFirstOn(const bitvector_ptr_t vector, size_t from);
+size_t BitVectorFindFirstOff(const bitvector_ptr_t vector, size_t from);
+
+/* DESCRIPTION:
+ * Functions combine src into dest word by word:
+ * dest &= src, dest |= src, dest ^= src, dest &= ~src
+ * vectors of different sizes would result in undefined behaviour
+ *
+ * PARAMS:
+ * dest - vector to modify
+ * src  - vector to combine with
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(n) in words
+ * space: O(1)
+ */
+void BitVectorAnd(bitvector_ptr_t dest, const bitvector_ptr_t src);
+void BitVectorOr(bitvector_ptr_t dest, const bitvector_ptr_t src);
+void BitVectorXor(bitvector_ptr_t dest, const bitvector_ptr_t src);
+void BitVectorAndNot(bitvector_ptr_t dest, const bitvector_ptr_t src);
+
+#endif /* __BITVECTOR_H__ */
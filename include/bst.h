@@ -30,6 +30,64 @@ typedef bst_node_t *bst_iter_t;
  */
 bst_t *BSTCreate(cmp_func_t cmp_func);
 
+/* DESCRIPTION:
+ * Function creates an empty bst that takes its nodes from chunks of
+ * chunk_capacity nodes instead of one malloc per node. removed nodes are
+ * kept for reuse, and destroying the bst frees whole chunks. chunks are
+ * made of 4KB pages and one node slot of every page is kept for the page
+ * header, so chunk_capacity is rounded up to whole pages.
+ * such a bst cannot take part in BSTSplit or BSTJoin.
+ *
+ * PARAMS:
+ * cmp_func       - pointer to the compare function
+ * chunk_capacity - number of nodes to allocate at a time
+ *         
+ * RETURN:
+ * Returns a pointer to the created bst, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+bst_t *BSTCreateArena(cmp_func_t cmp_func, size_t chunk_capacity);
+
+/* DESCRIPTION:
+ * Function creates an empty bst that keeps itself balanced (red-black), so
+ * that insert, remove, find and stepping an iterator stay O(log n) even
+ * when the elements come in sorted order. iterators behave exactly as in
+ * a bst from BSTCreate.
+ * such a bst cannot take part in BSTSplit or BSTJoin.
+ *
+ * PARAMS:
+ * cmp_func - pointer to the compare function
+ *         
+ * RETURN:
+ * Returns a pointer to the created bst, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+bst_t *BSTCreateBalanced(cmp_func_t cmp_func);
+
+/* DESCRIPTION:
+ * Function creates a perfectly balanced bst out of elements that are
+ * already sorted according to cmp_func, without comparing them
+ *
+ * PARAMS:
+ * cmp_func - pointer to the compare function
+ * elements - the sorted elements
+ * count    - number of elements
+ *         
+ * RETURN:
+ * Returns a pointer to the created bst, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(log n)
+ */
+bst_t *BSTCreateFromSorted(cmp_func_t cmp_func, void *elements[], size_t count);
+
 /* DESCRIPTION:
  * Function destroys and performs cleanup on the given bst.
  * passing an invalid bst pointer would result in undefined behaviour
@@ -42,7 +100,7 @@ bst_t *BSTCreate(cmp_func_t cmp_func);
  * void
  *
  * COMPLEXITY:
- * time: O(n)
+ * time: O(n), O(n / chunk_capacity) for an arena bst
  * space: O(1)
  */
 void BSTDestroy(bst_t *tree);
@@ -74,7 +132,7 @@ int BSTIsEmpty(const bst_t *tree);
  * pointer to the node that has been inserted, NULL if fails
  *
  * COMPLEXITY:
- * average time: O(log n) , worst: O(n)
+ * average time: O(log n) , worst: O(n), O(log n) in a balanced bst
  * space: O(1)
  */
 bst_iter_t BSTInsert(bst_t *tree, const void *data);
@@ -90,7 +148,7 @@ bst_iter_t BSTInsert(bst_t *tree, const void *data);
  * void 
  *
  * COMPLEXITY: 
- * time: O(log n), worst: O(n)
+ * time: O(log n), worst: O(n), O(log n) in a balanced bst
  * space: O(1)
  */
 void BSTRemove(bst_iter_t where);
@@ -107,7 +165,7 @@ void BSTRemove(bst_iter_t where);
  * iterator to the found data. if not found, it will return the iterator "to".
  *
  * COMPLEXITY:
- * time: O(log n) ,worst: O(n)
+ * time: O(log n) ,worst: O(n), O(log n) in a balanced bst
  * space: O(1)
  */
 bst_iter_t BSTFind(bst_t *tree, const void *data);
@@ -234,5 +292,48 @@ bst_iter_t BSTEnd(const bst_t *tree);
  */
 int BSTIsEqual(bst_iter_t iter_one, bst_iter_t iter_two);
 
+/* DESCRIPTION:
+ * Function joins pivot and all the elements of right into left, with pivot
+ * as the new root. every element of left must be smaller than pivot, and
+ * pivot must not be bigger than any element of right. right is left empty and
+ * still has to be destroyed. iterators to elements of both bsts stay valid.
+ * both bsts must have been created without an arena and without balancing.
+ * passing an invalid bst would result in undefined behaviour.
+ *
+ * PARAMS:
+ * left  - bst of the smaller elements, receives the result
+ * pivot - element that separates the two bsts
+ * right - bst of the bigger elements
+ *         
+ * RETURN:
+ * 0 for success, 1 if allocation failed - both bsts are then unchanged
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int BSTJoin(bst_t *left, const void *pivot, bst_t *right);
+
+/* DESCRIPTION:
+ * Function moves every element that is not smaller than key from tree to
+ * right. right must be empty and use the same compare function.
+ * iterators to the moved elements stay valid and now belong to right.
+ * both bsts must have been created without an arena and without balancing.
+ * passing an invalid bst would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree  - bst to split, keeps the elements smaller than key
+ * key   - key to split at
+ * right - empty bst, receives the rest of the elements
+ *         
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(log n), worst: O(n)
+ * space: O(1)
+ */
+void BSTSplit(bst_t *tree, const void *key, bst_t *right);
+
 #endif /* __BST_H__ */
 
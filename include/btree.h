@@ -0,0 +1,207 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _BTREE_H_
+#define _BTREE_H_
+
+#include <stddef.h> /* size_t */
+
+typedef int (*action_func_t)(void *data, void *param);
+typedef int (*cmp_func_t)(const void *data1, const void *data2);
+
+typedef struct btree btree_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct btree
+ * {
+ *		btree_node_t *root;
+ *		size_t height;
+ *		size_t size;
+ *		cmp_func_t cmp_func;
+ * }
+ *
+ * a B+ tree: every element lives in a leaf, inner nodes hold copies of
+ * element pointers as separators only, and leaves are chained in order for
+ * scans. nodes are 64 byte aligned and span whole cache lines, so a lookup
+ * over millions of elements touches 4-5 nodes instead of ~20.
+ * unlike the avl, elements must be unique according to cmp_func.
+ * a separator always points at an element that is still in the tree, so
+ * an element may be freed as soon as it is removed.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty btree
+ *
+ * PARAMS:
+ * cmp_func - pointer to the compare function
+ *
+ * RETURN:
+ * Returns a pointer to the created btree, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+btree_t *BTreeCreate(cmp_func_t cmp_func);
+
+/* DESCRIPTION:
+ * Function destroys and performs cleanup on the given btree,
+ * but not on the stored elements
+ * passing an invalid btree pointer would result in undefined behaviour
+ *
+ * PARAMS:
+ * tree - pointer to the btree to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(log n)
+ */
+void BTreeDestroy(btree_t *tree);
+
+/* DESCRIPTION:
+ * Function inserts the given element to the btree.
+ * passing an invalid tree would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - btree to insert the data to
+ * data - the data to insert
+ *
+ * RETURN:
+ * 0 for success, 1 if allocation failed or an equal element already exists
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+int BTreeInsert(btree_t *tree, void *data);
+
+/* DESCRIPTION:
+ * Function removes the element matching key from the btree, if there is one
+ * the tree keeps no pointer to the removed element, which may be freed
+ * once the function returns.
+ * passing an invalid tree would result in undefined behaviour.
+ *
+ * PARAMS:
+ * tree - btree to remove from
+ * key  - key to find the element to remove
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void BTreeRemove(btree_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function finds the element matching key
+ *
+ * PARAMS:
+ * tree - btree to search in
+ * key  - key to look for
+ *
+ * RETURN:
+ * the matching element, NULL if not found
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void *BTreeFind(const btree_t *tree, const void *key);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the btree
+ *
+ * PARAMS:
+ * tree - pointer to the btree
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t BTreeSize(const btree_t *tree);
+
+/* DESCRIPTION:
+ * Function checks whether the btree is empty
+ *
+ * PARAMS:
+ * tree - pointer to the btree
+ *
+ * RETURN:
+ * 1 if the btree is empty or 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int BTreeIsEmpty(const btree_t *tree);
+
+/* DESCRIPTION:
+ * Function performs an action on each element in ascending order, and stops
+ * at the first action that does not return 0.
+ * the action must not change the order of the elements
+ *
+ * PARAMS:
+ * tree         - pointer to the btree
+ * action_func  - function pointer to an action to perform on an element
+ * param        - element for action function
+ *
+ * RETURN:
+ * 0 if success, the failing action's return value otherwise
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(1)
+ */
+int BTreeForEach(btree_t *tree, action_func_t action_func, void *param);
+
+/* DESCRIPTION:
+ * Function performs an action on each element in [from, to) in ascending
+ * order, and stops at the first action that does not return 0.
+ * the action must not change the order of the elements
+ *
+ * PARAMS:
+ * tree         - pointer to the btree
+ * from         - key of the start of the range, included
+ * to           - key of the end of the range, excluded
+ * action_func  - function pointer to an action to perform on an element
+ * param        - element for action function
+ *
+ * RETURN:
+ * 0 if success, the failing action's return value otherwise
+ *
+ * COMPLEXITY:
+ * time: O(log n + k), k - number of elements in the range
+ * space: O(1)
+ */
+int BTreeForEachRange(btree_t *tree, const void *from, const void *to,
+                      action_func_t action_func, void *param);
+
+/* DESCRIPTION:
+ * Function checks the tree's height.
+ *
+ * PARAMS:
+ * tree - pointer to the tree to check height
+ *
+ * RETURN:
+ * The tree's height - 0 when empty, 1 when the root is a leaf.
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t BTreeHeight(const btree_t *tree);
+
+#endif /* _BTREE_H_ */
@@ -14,14 +14,36 @@ struct circbuff;
 
 typedef struct circbuff *circbuff_ptr_t;
 
+/*
+ * CB_OVERWRITE   - a full buffer drops its oldest bytes (default)
+ * CB_FAIL        - a write that does not fit writes nothing and fails
+ * CB_SHORT_WRITE - a write stores only as many bytes as fit
+ * CB_BLOCK       - the buffer is thread safe; writers wait for free space
+ *                  and readers wait for data, up to an optional timeout
+ */
+typedef enum cb_policy
+{
+	CB_OVERWRITE,
+	CB_FAIL,
+	CB_SHORT_WRITE,
+	CB_BLOCK
+}cb_policy_t;
+
 /*
  *
  * struct circbuff
  * {
+ *  size_t element_count;
+ *  size_t capacity;
  *  size_t read_index;
  *  size_t write_index;
- *  size_t capacity;
- *	char buff[1];
+ *  int is_mirrored;
+ *  cb_policy_t policy;
+ *  long timeout_ms;
+ *  pthread_mutex_t lock;
+ *  pthread_cond_t not_empty;
+ *  pthread_cond_t not_full;
+ *	char *data;
  * }
  *
  *
@@ -40,6 +62,49 @@ typedef struct circbuff *circbuff_ptr_t;
  */
 circbuff_ptr_t CircBuffCreate(size_t capacity);
 
+/* DESCRIPTION:
+ * Function creates an empty buffer whose storage is mapped twice back to
+ * back in virtual memory, so every readable or writable span is contiguous
+ * and spans returned by CircBuffReserve and CircBuffPeek never split at the
+ * wrap. capacity is rounded up to a multiple of the page size.
+ * destroy it with CircBuffDestroy like a regular buffer.
+ *
+ * PARAMS:
+ * capacity     - minimal capacity of buffer
+ *        
+ * RETURN:
+ * Returns a pointer to the new buffer, or NULL if capacity is 0 or the
+ * mapping failed
+ *
+ * COMPLEXITY:
+ * time: best - O(1), worst - indeterminable
+ * space: O(capacity)
+ */
+circbuff_ptr_t CircBuffCreateMirrored(size_t capacity);
+
+/* DESCRIPTION:
+ * Function sets what happens when a write does not fit in the buffer.
+ * new buffers start as CB_OVERWRITE. must be called right after creation,
+ * before the buffer is shared between threads.
+ * under CB_BLOCK a single producer and a single consumer may use the buffer
+ * concurrently, including through the zero-copy functions, which never wait.
+ * passing an invalid buffer would result in undefined behaviour
+ *
+ * PARAMS:
+ * buffer       - the buffer to configure
+ * policy       - one of cb_policy_t
+ * timeout_ms   - longest time a CB_BLOCK read or write waits, negative
+ *                to wait forever. ignored by other policies
+ *        
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void CircBuffSetPolicy(circbuff_ptr_t buffer, cb_policy_t policy, long timeout_ms);
+
 /* DESCRIPTION:
  * Function destroys and performs cleanup on the given buffer
  * passing an invalid buffer pointer would result in undefined behaviour
@@ -74,7 +139,8 @@ int CircBuffIsEmpty(const circbuff_ptr_t buffer);
 
 /* DESCRIPTION:
  * Function reads the next in line element in the buffer 
- * passing an empty buffer to read from would result in undefined behaviour
+ * under CB_BLOCK an empty buffer is waited on until data arrives or the
+ * timeout passes, otherwise reading an empty buffer reads nothing
  * passing an invalid buffer to write to would result in undefined behaviour
  *
  * PARAMS:
@@ -83,8 +149,7 @@ int CircBuffIsEmpty(const circbuff_ptr_t buffer);
  * to_write_to        - the buffer to write into
  * 
  * RETURN:															
- * number of bytes that have been read on success,
- * -1 when failed to read from 
+ * number of bytes that have been read, which may be less than num_of_bytes
  *
  * COMPLEXITY:
  * time: O(n)
@@ -94,7 +159,10 @@ ssize_t CircBuffRead(circbuff_ptr_t buffer, void *to_write_to, size_t num_of_byt
 
 /* DESCRIPTION:
  * Function writes to the buffer at the next available space
- * passing a full buffer would result in overwriting data
+ * what happens when the data does not fit depends on the buffer's policy:
+ * CB_OVERWRITE drops the oldest data, CB_FAIL writes nothing,
+ * CB_SHORT_WRITE writes what fits and CB_BLOCK waits for the reader until
+ * everything was written or the timeout passed
  * passing an invalid buffer would result in undefined behaviour
  * passing an invalid read from would result in undefined behaviour
  *
@@ -104,8 +172,9 @@ ssize_t CircBuffRead(circbuff_ptr_t buffer, void *to_write_to, size_t num_of_byt
  * num_of_bytes   - the number of bytes to write
  *      
  * RETURN:															
- * number of bytes that have been written on success,
- * -1 when failed to write to 
+ * number of bytes that have been written, which may be less than
+ * num_of_bytes under CB_SHORT_WRITE and CB_BLOCK,
+ * -1 when a CB_FAIL buffer has not enough free space
  * 
  * COMPLEXITY:
  * time: O(n) 
@@ -145,5 +214,84 @@ size_t CircBuffSize(const circbuff_ptr_t buffer);
  */
 size_t CircBuffFreeSpace(const circbuff_ptr_t buffer);
 
+/* DESCRIPTION:
+ * Function returns a pointer to the next writable byte in the buffer, so the
+ * caller can build data in place instead of copying it in with
+ * CircBuffWrite. the data becomes readable only after CircBuffCommit.
+ * on a regular buffer the span ends at the wrap, so less than requested may
+ * be reserved even if there is enough free space; a mirrored buffer reserves
+ * all the free space requested.
+ * passing an invalid buffer would result in undefined behaviour
+ *
+ * PARAMS:
+ * buffer         - the buffer to write to
+ * num_of_bytes   - the number of bytes requested
+ * reserved       - out param, the number of bytes that may be written
+ *      
+ * RETURN:
+ * pointer to the start of the writable span
+ * 
+ * COMPLEXITY:
+ * time: O(1) 
+ * space: O(1)
+ */
+void *CircBuffReserve(circbuff_ptr_t buffer, size_t num_of_bytes, size_t *reserved);
+
+/* DESCRIPTION:
+ * Function publishes bytes written into a span from CircBuffReserve
+ * committing more bytes than were reserved would result in undefined
+ * behaviour
+ *
+ * PARAMS:
+ * buffer         - the buffer that was written to
+ * num_of_bytes   - the number of bytes written
+ *      
+ * RETURN:
+ * void
+ * 
+ * COMPLEXITY:
+ * time: O(1) 
+ * space: O(1)
+ */
+void CircBuffCommit(circbuff_ptr_t buffer, size_t num_of_bytes);
+
+/* DESCRIPTION:
+ * Function returns a pointer to the oldest unread byte without copying it
+ * out. the span stays valid until it is consumed or overwritten.
+ * on a regular buffer the span ends at the wrap, so it may hold less than
+ * CircBuffSize bytes; on a mirrored buffer it always holds all of them.
+ * passing an invalid buffer would result in undefined behaviour
+ *
+ * PARAMS:
+ * buffer         - the buffer to read from
+ * readable       - out param, the number of bytes in the span
+ *      
+ * RETURN:
+ * pointer to the start of the readable span
+ * 
+ * COMPLEXITY:
+ * time: O(1) 
+ * space: O(1)
+ */
+const void *CircBuffPeek(const circbuff_ptr_t buffer, size_t *readable);
+
+/* DESCRIPTION:
+ * Function discards the oldest bytes of the buffer, usually after they were
+ * processed in place through CircBuffPeek
+ * consuming more bytes than CircBuffSize would result in undefined behaviour
+ *
+ * PARAMS:
+ * buffer         - the buffer to consume from
+ * num_of_bytes   - the number of bytes to discard
+ *      
+ * RETURN:
+ * void
+ * 
+ * COMPLEXITY:
+ * time: O(1) 
+ * space: O(1)
+ */
+void CircBuffConsume(circbuff_ptr_t buffer, size_t num_of_bytes);
+
 #endif /* __CIRCBUFF_H__ */
 
@@ -12,6 +12,10 @@ typedef int (*cmp_func_t)(const void *key1, const void *key2);
 
 typedef struct binary_heap bin_heap_t;
 
+/* names one element for as long as it is in the heap. once the element
+ * leaves the heap its handle may be given to a newly pushed element */
+typedef size_t bin_heap_handle_t;
+
 
 /* DESCRIPTION:
  * Function creates an empty binary heap
@@ -28,6 +32,82 @@ typedef struct binary_heap bin_heap_t;
  */
 bin_heap_t *BinHeapCreate(cmp_func_t cmp_fun);
 
+/* DESCRIPTION:
+ * Function creates an empty heap in which every node has up to arity
+ * children, stored next to each other. the storage is cache line aligned
+ * and offset so that each group of children starts on a multiple of
+ * arity entries: the children of an 8-ary node fill one cache line, those
+ * of a 4-ary node half of one. a wider heap is shallower, so popping
+ * touches fewer levels (and fewer cache lines) for a few more compares
+ * per level; 4 is usually the best for large heaps.
+ * BinHeapCreate is the same as passing 2.
+ *
+ * PARAMS:
+ * cmp_fun - pointer to the comapre function
+ * arity   - number of children of a node, at least 2
+ *
+ * RETURN:
+ * Returns a pointer to the created heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+bin_heap_t *BinHeapCreateDary(cmp_func_t cmp_fun, size_t arity);
+
+/* DESCRIPTION:
+ * Function creates an empty binary heap with the smallest element by
+ * cmp_fun on top instead of the biggest
+ *
+ * PARAMS:
+ * cmp_fun - pointer to the comapre function
+ *
+ * RETURN:
+ * Returns a pointer to the created heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+bin_heap_t *BinHeapCreateMin(cmp_func_t cmp_fun);
+
+/* DESCRIPTION:
+ * Function creates an empty binary heap in which equal elements come out
+ * in the order they were pushed. every push is numbered, and the number
+ * breaks ties - it is kept in an array beside the elements, which moves
+ * with them, so no search is needed.
+ * the order holds between elements pushed less than 2^31 pushes apart.
+ *
+ * PARAMS:
+ * cmp_fun - pointer to the comapre function
+ *
+ * RETURN:
+ * Returns a pointer to the created heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+bin_heap_t *BinHeapCreateStable(cmp_func_t cmp_fun);
+
+/* DESCRIPTION:
+ * Function makes room for capacity elements, so pushing up to that many
+ * never allocates.
+ * passing an invalid binary heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * bin_heap - binary heap to reserve room in
+ * capacity - number of elements to make room for
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(capacity)
+ */
+int BinHeapReserve(bin_heap_t *bin_heap, size_t capacity);
+
 /* DESCRIPTION:
  * Function destroys and performs cleanup on the given binary heap.
  * passing an invalid binary heap would result in undefined behaviour
@@ -78,6 +158,67 @@ int BinHeapIsEmpty(const bin_heap_t *bin_heap);
 
 int BinHeapPush(bin_heap_t *bin_heap, const void *data);
 
+/* DESCRIPTION:
+ * Function pushes data like BinHeapPush, and gives back a handle to it for
+ * BinHeapRemoveHandle, BinHeapUpdate and BinHeapGetData. only elements
+ * pushed this way have their place tracked. the first call makes the heap
+ * keep an array beside its elements from then on; heaps that never give
+ * a handle hold and move only the element pointers.
+ * passing an invalid binary heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * bin_heap - binary heap to push the data to
+ * data     - the data to push
+ * handle   - receives the handle of the pushed element
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL
+ *
+ * COMPLEXITY:
+ * time: O(log n), O(n) the first time
+ * space: O(1)
+ */
+int BinHeapPushHandle(bin_heap_t *bin_heap, const void *data, bin_heap_handle_t *handle);
+
+/* DESCRIPTION:
+ * Function pushes count elements at once. room is reserved once for all of
+ * them; when they are at least as many as the elements already in the heap
+ * the whole heap is rebuilt in linear time instead of pushing one by one.
+ * the elements get no handles.
+ * passing an invalid binary heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * bin_heap - binary heap to push the data to
+ * elements - the elements to push
+ * count    - number of elements
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL - the heap is then unchanged
+ *
+ * COMPLEXITY:
+ * time: O(n + count) when count >= n, O(count * log n) otherwise
+ * space: O(1)
+ */
+int BinHeapPushAll(bin_heap_t *bin_heap, void *elements[], size_t count);
+
+/* DESCRIPTION:
+ * Function creates a binary heap holding the given elements, built in
+ * linear time
+ *
+ * PARAMS:
+ * cmp_fun  - pointer to the comapre function
+ * elements - the elements, in any order
+ * count    - number of elements
+ *
+ * RETURN:
+ * Returns a pointer to the created binary heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(n)
+ */
+bin_heap_t *BinHeapCreateFromArray(cmp_func_t cmp_fun, void *elements[], size_t count);
+
 /* DESCRIPTION:
  * Function pops the first element from the given binary heap.
  * passing an invalid heap would result in undefined behaviour.
@@ -110,6 +251,24 @@ void BinHeapPop(bin_heap_t *bin_heap);
  */
 void *BinHeapPeek(bin_heap_t *bin_heap);
 
+/* DESCRIPTION:
+ * Function replaces the first element with data and returns the old one -
+ * as a pop followed by a push, but with a single sift. data gets no handle.
+ * passing an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * bin_heap - binary heap
+ * data     - the element to push in place of the first
+ *
+ * RETURN:
+ * the element that was first.
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void *BinHeapReplaceTop(bin_heap_t *bin_heap, const void *data);
+
 /* DESCRIPTION:
  * Function pops data from the given binary heap based on the given key and is_match function.
  * passing an invalid heap would result in undefined behaviour.
@@ -123,11 +282,66 @@ void *BinHeapPeek(bin_heap_t *bin_heap);
  * pointer to the data that has been removed. If not found, will return NULL.
  *
  * COMPLEXITY:
- * time: O(log n)
+ * time: O(n)
  * space: O(1)
  */
 void *BinHeapRemove(bin_heap_t *bin_heap, heap_is_match_t is_match, void *param);
 
+/* DESCRIPTION:
+ * Function removes the element of the given handle.
+ * passing a handle of an element that is no longer in the heap would
+ * result in undefined behaviour.
+ *
+ * PARAMS:
+ * bin_heap - binary heap to remove from.
+ * handle   - handle of the element to remove
+ *
+ * RETURN:
+ * pointer to the data that has been removed.
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void *BinHeapRemoveHandle(bin_heap_t *bin_heap, bin_heap_handle_t handle);
+
+/* DESCRIPTION:
+ * Function puts the element of the given handle back in its place after
+ * its key was changed, in either direction (increase or decrease key).
+ * passing a handle of an element that is no longer in the heap would
+ * result in undefined behaviour.
+ *
+ * PARAMS:
+ * bin_heap - binary heap the element is in.
+ * handle   - handle of the changed element
+ *
+ * RETURN:
+ * void.
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void BinHeapUpdate(bin_heap_t *bin_heap, bin_heap_handle_t handle);
+
+/* DESCRIPTION:
+ * Function returns the data of the element of the given handle.
+ * passing a handle of an element that is no longer in the heap would
+ * result in undefined behaviour.
+ *
+ * PARAMS:
+ * bin_heap - binary heap the element is in.
+ * handle   - handle of the element
+ *
+ * RETURN:
+ * pointer to the data.
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *BinHeapGetData(bin_heap_t *bin_heap, bin_heap_handle_t handle);
+
 /* DESCRIPTION:
  * Function returns the number of elements in the binary heap.
  * passing an invalid binary heap would result in undefined behaviour.
@@ -0,0 +1,161 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _KEY_HEAP_H_
+#define _KEY_HEAP_H_
+
+#include <stddef.h> /* size_t */
+
+typedef struct key_heap key_heap_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct key_heap
+ * {
+ *		key_heap_entry_t *block;
+ *		key_heap_entry_t *entries;
+ *		size_t arity;
+ *		size_t size;
+ *		size_t capacity;
+ * }
+ *
+ * a d-ary min heap that keeps an unsigned long key next to each element,
+ * so ordering never calls a compare function or touches the elements.
+ * an entry is 16 bytes and the array is cache line aligned with the
+ * children of every node starting on a group boundary, so with arity 4 a
+ * node's children fill exactly one cache line (two with arity 8).
+ * the element with the smallest key is on top.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty key heap
+ *
+ * PARAMS:
+ * arity    - number of children of a node, at least 2; 4 or 8 recommended
+ * capacity - number of elements to reserve room for, the heap grows past it
+ *            when needed
+ *
+ * RETURN:
+ * Returns a pointer to the created heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(capacity)
+ */
+key_heap_t *KeyHeapCreate(size_t arity, size_t capacity);
+
+/* DESCRIPTION:
+ * Function destroys the heap, but not the stored elements
+ *
+ * PARAMS:
+ * heap - pointer to the heap to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void KeyHeapDestroy(key_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function pushes data with the given key
+ *
+ * PARAMS:
+ * heap - heap to push to
+ * key  - sort key of the element
+ * data - the element
+ *
+ * RETURN:
+ * 0 for success, 1 if growing the heap failed
+ *
+ * COMPLEXITY:
+ * time: O(log n) - amortized, growing copies the heap
+ * space: O(1)
+ */
+int KeyHeapPush(key_heap_t *heap, unsigned long key, void *data);
+
+/* DESCRIPTION:
+ * Function removes the element with the smallest key and returns it.
+ * popping an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - heap to pop from
+ *
+ * RETURN:
+ * the removed element
+ *
+ * COMPLEXITY:
+ * time: O(arity * log n / log arity)
+ * space: O(1)
+ */
+void *KeyHeapPop(key_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the element with the smallest key.
+ * peeking an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * the element on top
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *KeyHeapPeek(const key_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the smallest key in the heap.
+ * peeking an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * the key of the element on top
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+unsigned long KeyHeapPeekKey(const key_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the heap
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t KeyHeapSize(const key_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function checks if the heap is empty
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * 1 if empty, 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int KeyHeapIsEmpty(const key_heap_t *heap);
+
+#endif /* _KEY_HEAP_H_ */
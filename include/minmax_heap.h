@@ -0,0 +1,176 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _MINMAX_HEAP_H_
+#define _MINMAX_HEAP_H_
+
+#include <stddef.h> /* size_t */
+
+typedef struct minmax_heap minmax_heap_t;
+
+typedef int (*minmax_cmp_func_t)(const void *data1, const void *data2);
+
+/*
+ * Recommended struct impl:
+ *
+ * struct minmax_heap
+ * {
+ *		vector_t *vector;
+ *		minmax_cmp_func_t cmp;
+ * }
+ *
+ * a double ended priority queue: both the smallest and the biggest element
+ * by cmp can be read in O(1) and popped in O(log n).
+ * the elements are a complete binary tree in a vector, like bin_heap_t,
+ * whose levels take turns: an element on an even level (the root's) is
+ * the smallest of its subtree, one on an odd level the biggest of its
+ * subtree. the smallest is the root, the biggest one of its two children.
+ * it suits bounded queues that serve from one end and evict from the
+ * other when full. elements that compare equal come out in no particular
+ * order.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty min-max heap
+ *
+ * PARAMS:
+ * cmp - compare function, returns positive if data1 is bigger than data2
+ *
+ * RETURN:
+ * Returns a pointer to the created heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+minmax_heap_t *MinMaxHeapCreate(minmax_cmp_func_t cmp);
+
+/* DESCRIPTION:
+ * Function destroys the heap, but not the stored elements
+ *
+ * PARAMS:
+ * heap - pointer to the heap to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void MinMaxHeapDestroy(minmax_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function pushes data into the heap
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ * data - the element
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL
+ *
+ * COMPLEXITY:
+ * time: O(log n), amortized
+ * space: O(1)
+ */
+int MinMaxHeapPush(minmax_heap_t *heap, void *data);
+
+/* DESCRIPTION:
+ * Function removes the smallest element and returns it.
+ * trying to pop an empty heap will result in undefined behavior
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * pointer to the smallest element
+ *
+ * COMPLEXITY:
+ * time: O(log n), amortized
+ * space: O(1)
+ */
+void *MinMaxHeapPopMin(minmax_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function removes the biggest element and returns it.
+ * trying to pop an empty heap will result in undefined behavior
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * pointer to the biggest element
+ *
+ * COMPLEXITY:
+ * time: O(log n), amortized
+ * space: O(1)
+ */
+void *MinMaxHeapPopMax(minmax_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the smallest element.
+ * peeking an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * pointer to the smallest element
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *MinMaxHeapPeekMin(const minmax_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the biggest element.
+ * peeking an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * pointer to the biggest element
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *MinMaxHeapPeekMax(const minmax_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the heap
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t MinMaxHeapSize(const minmax_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function checks whether the heap is empty
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * 1 if the heap is empty or 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int MinMaxHeapIsEmpty(const minmax_heap_t *heap);
+
+#endif /* _MINMAX_HEAP_H_ */
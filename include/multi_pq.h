@@ -0,0 +1,155 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _MULTI_PQ_H_
+#define _MULTI_PQ_H_
+
+#include <stddef.h> /* size_t */
+
+typedef struct multi_pq multi_pq_t;
+
+typedef int (*multi_pq_cmp_t)(const void *data1, const void *data2);
+
+/*
+ * Recommended struct impl:
+ *
+ * struct multi_pq
+ * {
+ *		multi_pq_queue_t *queues;
+ *		size_t num_of_queues;
+ *		int is_strict;
+ * }
+ *
+ * a priority queue that many threads may enqueue to and dequeue from at
+ * once (MultiQueue). the elements are spread over several binary heaps,
+ * each with its own lock and on its own cache line.
+ * enqueue pushes to a random heap whose lock is free. a relaxed dequeue
+ * picks two random heaps and pops the better of their tops - usually one
+ * of the best elements, but not always the best; on average the rank of
+ * the element taken grows with the number of heaps, not the number of
+ * elements. threads working on different heaps never wait for each other,
+ * so throughput keeps growing with the threads. 2 to 4 heaps per thread
+ * are recommended.
+ * a strict queue dequeues the best element of all, holding every lock
+ * while it looks - enqueue still scales, dequeue does not.
+ * like pq_heap_t, the biggest element by cmp comes out first.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty relaxed concurrent priority queue
+ *
+ * PARAMS:
+ * cmp           - compare function, returns positive if data1 should come
+ *                 out before data2
+ * num_of_queues - number of heaps, at least 1
+ *
+ * RETURN:
+ * Returns a pointer to the created queue, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(num_of_queues)
+ * space: O(num_of_queues)
+ */
+multi_pq_t *MultiPQCreate(multi_pq_cmp_t cmp, size_t num_of_queues);
+
+/* DESCRIPTION:
+ * Function creates an empty strict concurrent priority queue - dequeue
+ * always returns the best element in the queue
+ *
+ * PARAMS:
+ * cmp           - compare function, as in MultiPQCreate
+ * num_of_queues - number of heaps, at least 1
+ *
+ * RETURN:
+ * Returns a pointer to the created queue, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(num_of_queues)
+ * space: O(num_of_queues)
+ */
+multi_pq_t *MultiPQCreateStrict(multi_pq_cmp_t cmp, size_t num_of_queues);
+
+/* DESCRIPTION:
+ * Function destroys the queue, but not the stored elements.
+ * no other thread may use the queue while it is destroyed.
+ *
+ * PARAMS:
+ * queue - pointer to the queue to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(num_of_queues)
+ * space: O(1)
+ */
+void MultiPQDestroy(multi_pq_t *queue);
+
+/* DESCRIPTION:
+ * Function enqueues data. safe to call from many threads at once.
+ *
+ * PARAMS:
+ * queue - pointer to the queue
+ * data  - the element
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+int MultiPQEnqueue(multi_pq_t *queue, void *data);
+
+/* DESCRIPTION:
+ * Function removes an element and returns it - one of the best for a
+ * relaxed queue, the best for a strict one. safe to call from many
+ * threads at once.
+ *
+ * PARAMS:
+ * queue - pointer to the queue
+ *
+ * RETURN:
+ * pointer to the element, NULL if the queue was found empty
+ *
+ * COMPLEXITY:
+ * time: O(log n) - relaxed, O(num_of_queues + log n) - strict
+ * space: O(1)
+ */
+void *MultiPQDequeue(multi_pq_t *queue);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the queue. while other
+ * threads change the queue the result may already be out of date.
+ *
+ * PARAMS:
+ * queue - pointer to the queue
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(num_of_queues)
+ * space: O(1)
+ */
+size_t MultiPQSize(const multi_pq_t *queue);
+
+/* DESCRIPTION:
+ * Function checks whether the queue is empty, as MultiPQSize
+ *
+ * PARAMS:
+ * queue - pointer to the queue
+ *
+ * RETURN:
+ * 1 if the queue is empty or 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(num_of_queues)
+ * space: O(1)
+ */
+int MultiPQIsEmpty(const multi_pq_t *queue);
+
+#endif /* _MULTI_PQ_H_ */
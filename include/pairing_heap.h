@@ -0,0 +1,158 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _PAIRING_HEAP_H_
+#define _PAIRING_HEAP_H_
+
+#include <stddef.h> /* size_t */
+
+typedef struct pairing_heap pairing_heap_t;
+
+typedef int (*pairing_cmp_func_t)(const void *data1, const void *data2);
+
+/*
+ * Recommended struct impl:
+ *
+ * struct pairing_heap
+ * {
+ *		pairing_node_t *root;
+ *		size_t size;
+ *		pairing_cmp_func_t cmp;
+ * }
+ *
+ * a heap ordered tree where every node keeps its first child and its next
+ * sibling. two heaps merge by making the smaller root the first child of
+ * the bigger one, so push and merge are O(1); pop pairs up the children of
+ * the old root and merges the pairs back into one tree.
+ * like bin_heap_t, the biggest element by cmp is on top.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty pairing heap
+ *
+ * PARAMS:
+ * cmp - compare function, returns positive if data1 should be above data2
+ *
+ * RETURN:
+ * Returns a pointer to the created heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+pairing_heap_t *PairingHeapCreate(pairing_cmp_func_t cmp);
+
+/* DESCRIPTION:
+ * Function destroys the heap, but not the stored elements
+ *
+ * PARAMS:
+ * heap - pointer to the heap to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(1)
+ */
+void PairingHeapDestroy(pairing_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function pushes data to the heap
+ *
+ * PARAMS:
+ * heap - heap to push to
+ * data - the element
+ *
+ * RETURN:
+ * 0 for success, 1 on allocation failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int PairingHeapPush(pairing_heap_t *heap, void *data);
+
+/* DESCRIPTION:
+ * Function removes the top element and returns it.
+ * popping an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - heap to pop from
+ *
+ * RETURN:
+ * the removed element
+ *
+ * COMPLEXITY:
+ * time: O(log n) - amortized
+ * space: O(1)
+ */
+void *PairingHeapPop(pairing_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the top element.
+ * peeking an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * the element on top
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *PairingHeapPeek(const pairing_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function moves all the elements of src into dest, leaving src empty.
+ * both heaps must use the same compare function.
+ *
+ * PARAMS:
+ * dest - heap to merge into
+ * src  - heap to merge from, stays valid and empty
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void PairingHeapMerge(pairing_heap_t *dest, pairing_heap_t *src);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the heap
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t PairingHeapSize(const pairing_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function checks if the heap is empty
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * 1 if empty, 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int PairingHeapIsEmpty(const pairing_heap_t *heap);
+
+#endif /* _PAIRING_HEAP_H_ */
@@ -13,6 +13,9 @@ typedef struct pq_heap pq_heap_t;
 typedef int (*pq_heap_cmp_t)(const void *data1, const void *data2);
 typedef int (*pq_heap_is_match_t)(const void *data, const void *param);
 
+/* names one element for as long as it is in the queue */
+typedef size_t pq_heap_handle_t;
+
 /* DESCRIPTION:
  * Function creates an empty priority queue
  *
@@ -28,6 +31,23 @@ typedef int (*pq_heap_is_match_t)(const void *data, const void *param);
  */
 pq_heap_t *PQHeapCreate(pq_heap_cmp_t func);
 
+/* DESCRIPTION:
+ * Function creates an empty priority queue in which elements of equal
+ * priority are dequeued in the order they were enqueued (FIFO), without
+ * any extra allocation or search - see BinHeapCreateStable
+ *
+ * PARAMS:
+ * compare function
+ *
+ * RETURN:
+ * Returns a pointer to the created priority queue
+ *
+ * COMPLEXITY:
+ * time: best - O(1), worst - indeterminable
+ * space: O(1)
+ */
+pq_heap_t *PQHeapCreateStable(pq_heap_cmp_t func);
+
 /* DESCRIPTION:
  * Function destroys and performs cleanup on the given queue.
  * passing an invalid queue pointer would result in undefined behaviour
@@ -108,6 +128,60 @@ void *PQHeapDequeue(pq_heap_t *queue);
  */
 void *PQHeapErase(pq_heap_t *queue, pq_heap_is_match_t is_match, const void *param);
 
+/* DESCRIPTION:
+ * Function enqueues data like PQHeapEnqueue, and gives back a handle to it
+ * for PQHeapEraseHandle and PQHeapUpdate.
+ * passing an invalid queue would result in undefined behaviour.
+ *
+ * PARAMS:
+ * queue  - pointer to the queue
+ * data   - the element to enqueue
+ * handle - receives the handle of the element
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+int PQHeapEnqueueHandle(pq_heap_t *queue, void *data, pq_heap_handle_t *handle);
+
+/* DESCRIPTION:
+ * Function removes the element of the given handle from the queue and
+ * returns it. the handle must belong to an element still in the queue.
+ *
+ * PARAMS:
+ * queue  - pointer to the queue
+ * handle - handle of the element to remove
+ *
+ * RETURN:
+ * pointer to the element.
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void *PQHeapEraseHandle(pq_heap_t *queue, pq_heap_handle_t handle);
+
+/* DESCRIPTION:
+ * Function moves the element of the given handle to its new place after
+ * its priority was changed, either up or down.
+ * the handle must belong to an element still in the queue.
+ *
+ * PARAMS:
+ * queue  - pointer to the queue
+ * handle - handle of the changed element
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(log n)
+ * space: O(1)
+ */
+void PQHeapUpdate(pq_heap_t *queue, pq_heap_handle_t handle);
+
 /* DESCRIPTION:
  * Function returns the number of elements in the queue.
  * passing an invalid queue would result in undefined behaviour.
@@ -85,7 +85,8 @@ int PriorityQIsEmpty(const priority_q_t *queue);
 int PriorityQEnqueue(priority_q_t *queue, void *data);
 
 /* DESCRIPTION:
- * Function removes the first element of the queue and returns it
+ * Function removes the first element of the queue and returns it.
+ * elements of equal priority are dequeued in the order they were enqueued.
  * trying to Dequeue an empty queue will result in undefined behavior
  *
  * PARAMS:
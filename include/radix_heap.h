@@ -0,0 +1,185 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _RADIX_HEAP_H_
+#define _RADIX_HEAP_H_
+
+#include <stddef.h> /* size_t */
+
+typedef struct radix_heap radix_heap_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct radix_heap
+ * {
+ *		radix_bucket_t buckets[NUM_OF_BUCKETS];
+ *		unsigned long last;
+ *		size_t size;
+ *		size_t min_bucket;
+ *		size_t min_index;
+ * }
+ *
+ * a monotone priority queue for unsigned long keys, such as timestamps.
+ * the smallest key comes out first, and a key may only be enqueued if it
+ * is not smaller than the last key dequeued - the usual case for timers
+ * and event simulations.
+ * bucket 0 holds the keys equal to last, bucket i the keys whose highest
+ * bit differing from last is bit i - 1. when bucket 0 runs out, the lowest
+ * non empty bucket is split over the buckets below it. an element moves
+ * down at most once per bucket, so enqueue and dequeue are O(1) amortized
+ * for a fixed key width, and no compare function is ever called.
+ * elements with equal keys come out in no particular order.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty radix heap
+ *
+ * PARAMS:
+ * none
+ *
+ * RETURN:
+ * Returns a pointer to the created heap, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+radix_heap_t *RadixHeapCreate(void);
+
+/* DESCRIPTION:
+ * Function destroys the heap, but not the stored elements
+ *
+ * PARAMS:
+ * heap - pointer to the heap to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void RadixHeapDestroy(radix_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function checks whether the heap is empty
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * 1 if the heap is empty or 0 otherwise
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int RadixHeapIsEmpty(const radix_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function enqueues data with the given key.
+ * the key must not be smaller than the last dequeued key.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ * key  - priority of the element, smaller comes out first
+ * data - the element
+ *
+ * RETURN:
+ * 0 for SUCCESS, 1 for FAIL - when the key is smaller than the last
+ * dequeued key or allocation failed
+ *
+ * COMPLEXITY:
+ * time: O(1) - amortized
+ * space: O(1)
+ */
+int RadixHeapEnqueue(radix_heap_t *heap, unsigned long key, void *data);
+
+/* DESCRIPTION:
+ * Function removes the element with the smallest key and returns it.
+ * trying to Dequeue an empty heap will result in undefined behavior
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * pointer to the element, NULL if splitting a bucket failed to allocate -
+ * the heap is then unchanged
+ *
+ * COMPLEXITY:
+ * time: O(1) - amortized
+ * space: O(1)
+ */
+void *RadixHeapDequeue(radix_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the element with the smallest key. it does not move the
+ * bound for enqueue, which stays the last dequeued key. finding the
+ * element may scan a bucket and caches where it is, so the heap is not
+ * const.
+ * peeking an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * pointer to the element
+ *
+ * COMPLEXITY:
+ * time: O(1) - amortized
+ * space: O(1)
+ */
+void *RadixHeapPeek(radix_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the smallest key in the heap, as RadixHeapPeek.
+ * peeking an empty heap would result in undefined behaviour.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * the smallest key
+ *
+ * COMPLEXITY:
+ * time: O(1) - amortized
+ * space: O(1)
+ */
+unsigned long RadixHeapPeekKey(radix_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function returns the number of elements in the heap
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t RadixHeapSize(const radix_heap_t *heap);
+
+/* DESCRIPTION:
+ * Function removes all the elements and lets any key be enqueued again.
+ * the buckets keep their memory for reuse.
+ *
+ * PARAMS:
+ * heap - pointer to the heap
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void RadixHeapClear(radix_heap_t *heap);
+
+#endif /* _RADIX_HEAP_H_ */
@@ -0,0 +1,125 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef __RANKSELECT_H__
+#define __RANKSELECT_H__
+
+#include <stddef.h> /* size_t */
+
+#include "bitvector.h"
+
+struct rank_select;
+
+typedef struct rank_select *rank_select_ptr_t;
+typedef struct rank_select rank_select_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct rank_select
+ * {
+ *		const bitarray_t *words;
+ *		size_t num_of_bits;
+ *		size_t num_of_blocks;
+ *		size_t total_on;
+ *		size_t *super_ranks;
+ *		uint16_t *block_ranks;
+ *		size_t num_of_samples;
+ *		size_t *select_samples;
+ * }
+ *
+ * a read only index over a bit vector. the vector is split into 512 bit
+ * blocks and 64K bit superblocks; each superblock stores the number of on
+ * bits before it and each block the number of on bits before it inside its
+ * superblock, about 3% extra space. every 8192nd on bit also records the
+ * block it falls in, to narrow down select.
+ * the index does not follow the vector - any change to the vector requires
+ * destroying the index and creating a new one.
+ */
+
+
+/* DESCRIPTION:
+ * Function builds a rank/select index over the given vector
+ * the vector must outlive the index
+ *
+ * PARAMS:
+ * vector - the vector to index
+ *
+ * RETURN:
+ * Returns a pointer to the new index, or NULL on error
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(n) - a few percent of the vector
+ */
+rank_select_ptr_t RankSelectCreate(const bitvector_ptr_t vector);
+
+/* DESCRIPTION:
+ * Function destroys the index, the indexed vector is left untouched
+ *
+ * PARAMS:
+ * index - pointer to the index to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void RankSelectDestroy(rank_select_ptr_t index);
+
+/* DESCRIPTION:
+ * Function counts the bits that are on before position, i.e. in
+ * [0, position). position may be equal to the size of the vector
+ * position past the end of the vector would result in undefined behaviour
+ *
+ * PARAMS:
+ * index    - the index to query
+ * position - the bit to count up to, excluded
+ *
+ * RETURN:
+ * number of bits on before position
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t RankSelectRank(const rank_select_ptr_t index, size_t position);
+
+/* DESCRIPTION:
+ * Function finds the position of the k-th bit that is on, counting from 0,
+ * so RankSelectRank(index, RankSelectSelect(index, k)) == k
+ *
+ * PARAMS:
+ * index - the index to query
+ * k     - number of on bits to skip
+ *
+ * RETURN:
+ * position of the bit, or the size of the vector if it has k or fewer on
+ * bits
+ *
+ * COMPLEXITY:
+ * time: O(1) on average, O(log n) worst for very sparse vectors
+ * space: O(1)
+ */
+size_t RankSelectSelect(const rank_select_ptr_t index, size_t k);
+
+/* DESCRIPTION:
+ * Function returns the number of bits that are on in the whole vector
+ *
+ * PARAMS:
+ * index - the index to query
+ *
+ * RETURN:
+ * number of bits on
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t RankSelectCountOn(const rank_select_ptr_t index);
+
+#endif /* __RANKSELECT_H__ */
@@ -52,7 +52,7 @@ void HSchedulerDestroy(scheduler_t *scheduler);
  * func, param, interval - for tasks creation     
  *
  * COMPLEXITY:
- * time: O(n) 
+ * time: O(log n) 
  * space: O(1)
  */
 UID_t HSchedulerAddTask(scheduler_t *scheduler, action_func *func, void* param, size_t interval_in_seconds);
@@ -69,7 +69,7 @@ UID_t HSchedulerAddTask(scheduler_t *scheduler, action_func *func, void* param,
  * success \ fail
  *
  * COMPLEXITY:
- * time: O(n) 
+ * time: O(log n) - the task is found by its UID, not by a scan
  * space: O(1)
  */
 int HSchedulerRemoveTask(scheduler_t *scheduler, UID_t uid);
@@ -84,7 +84,7 @@ int HSchedulerRemoveTask(scheduler_t *scheduler, UID_t uid);
  *         
  *
  * COMPLEXITY:
- * time: O(n)
+ * time: O(n log n)
  * space: O(1)
  */
 void HSchedulerClear(scheduler_t *scheduler);
@@ -0,0 +1,273 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _SKIPLIST_H_
+#define _SKIPLIST_H_
+
+#include <stddef.h> /* size_t */
+
+typedef int (*action_func_t)(void *data, void *param);
+typedef int (*cmp_func_t)(const void *data1, const void *data2);
+
+typedef struct skiplist skiplist_t;
+typedef struct skiplist_node skiplist_node_t;
+typedef skiplist_node_t *skiplist_iter_t;
+
+/*
+ * Recommended struct impl:
+ *
+ * struct skiplist
+ * {
+ *		skiplist_node_t *head;
+ *		cmp_func_t cmp_func;
+ *		size_t size;
+ *		unsigned long level_seed;
+ *		unsigned long epoch;
+ *		long readers[2];
+ *		pthread_mutex_t retired_lock;
+ *		skiplist_node_t *retired[2];
+ * }
+ *
+ * an ordered map that many threads may use at once (lazy skip list).
+ * Find and iteration never take a lock and never wait; Insert and Remove
+ * lock only the few nodes around the element they change, so writers to
+ * different parts of the map do not get in each other's way.
+ * removed nodes are freed by a later Remove once every read section that
+ * could still reach them has ended, or at destroy. read sections that keep
+ * overlapping do not hold them back.
+ * elements must be unique according to cmp_func.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty skiplist
+ *
+ * PARAMS:
+ * cmp_func - pointer to the compare function
+ *
+ * RETURN:
+ * Returns a pointer to the created skiplist, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+skiplist_t *SkipListCreate(cmp_func_t cmp_func);
+
+/* DESCRIPTION:
+ * Function destroys and performs cleanup on the given skiplist, but not on
+ * the stored elements. no other thread may use the skiplist at that time.
+ *
+ * PARAMS:
+ * list - pointer to the skiplist to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(n)
+ * space: O(1)
+ */
+void SkipListDestroy(skiplist_t *list);
+
+/* DESCRIPTION:
+ * Function inserts the given element. thread safe.
+ *
+ * PARAMS:
+ * list - skiplist to insert the data to
+ * data - the data to insert
+ *
+ * RETURN:
+ * 0 for success, 1 if allocation failed or an equal element already exists
+ *
+ * COMPLEXITY:
+ * time: O(log n) expected
+ * space: O(1)
+ */
+int SkipListInsert(skiplist_t *list, void *data);
+
+/* DESCRIPTION:
+ * Function removes the element matching key. thread safe.
+ *
+ * PARAMS:
+ * list - skiplist to remove from
+ * key  - key to find the element to remove
+ *
+ * RETURN:
+ * the removed element, NULL if there was none
+ *
+ * COMPLEXITY:
+ * time: O(log n) expected
+ * space: O(1)
+ */
+void *SkipListRemove(skiplist_t *list, const void *key);
+
+/* DESCRIPTION:
+ * Function finds the element matching key. thread safe, never blocks.
+ *
+ * PARAMS:
+ * list - skiplist to search in
+ * key  - key to look for
+ *
+ * RETURN:
+ * the matching element, NULL if not found
+ *
+ * COMPLEXITY:
+ * time: O(log n) expected
+ * space: O(1)
+ */
+void *SkipListFind(skiplist_t *list, const void *key);
+
+/* DESCRIPTION:
+ * Function returns the number of elements. while other threads change the
+ * skiplist the result may already be out of date.
+ *
+ * PARAMS:
+ * list - pointer to the skiplist
+ *
+ * RETURN:
+ * number of elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t SkipListSize(const skiplist_t *list);
+
+/* DESCRIPTION:
+ * Function marks the calling thread as reading the skiplist, so that nodes
+ * it can reach are not freed under it. iterators may only be used between
+ * SkipListReadBegin and SkipListReadEnd; keep these sections short, nodes
+ * removed while one is open are not freed until it ends.
+ *
+ * PARAMS:
+ * list - pointer to the skiplist
+ *
+ * RETURN:
+ * a ticket to pass to SkipListReadEnd
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int SkipListReadBegin(skiplist_t *list);
+
+/* DESCRIPTION:
+ * Function ends a read section started by SkipListReadBegin. iterators
+ * taken inside the section must not be used after it.
+ *
+ * PARAMS:
+ * list   - pointer to the skiplist
+ * ticket - the value SkipListReadBegin returned for this section
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void SkipListReadEnd(skiplist_t *list, int ticket);
+
+/* DESCRIPTION:
+ * Function returns an iterator to the smallest element, or the end if the
+ * skiplist is empty. must be called inside a read section.
+ *
+ * PARAMS:
+ * list - pointer to the skiplist
+ *
+ * RETURN:
+ * iterator to the first element
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+skiplist_iter_t SkipListBegin(skiplist_t *list);
+
+/* DESCRIPTION:
+ * Function returns an iterator to the smallest element that is not smaller
+ * than key, or the end if there is none. must be called inside a read
+ * section.
+ *
+ * PARAMS:
+ * list - pointer to the skiplist
+ * key  - key to search from
+ *
+ * RETURN:
+ * iterator to the found element
+ *
+ * COMPLEXITY:
+ * time: O(log n) expected
+ * space: O(1)
+ */
+skiplist_iter_t SkipListLowerBound(skiplist_t *list, const void *key);
+
+/* DESCRIPTION:
+ * Function returns the end iterator, which comes after the biggest element
+ *
+ * PARAMS:
+ * list - pointer to the skiplist
+ *
+ * RETURN:
+ * the end iterator
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+skiplist_iter_t SkipListEnd(const skiplist_t *list);
+
+/* DESCRIPTION:
+ * Function returns an iterator to the next bigger element that is still in
+ * the skiplist. elements inserted or removed meanwhile by other threads may
+ * or may not be seen, but the order always holds.
+ * must be called inside a read section, and not on the end.
+ *
+ * PARAMS:
+ * where - iterator to move from
+ *
+ * RETURN:
+ * iterator to the next element
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+skiplist_iter_t SkipListIterNext(skiplist_iter_t where);
+
+/* DESCRIPTION:
+ * Function returns the element of the iterator.
+ * calling it on the end would result in undefined behaviour.
+ *
+ * PARAMS:
+ * where - iterator to read
+ *
+ * RETURN:
+ * the element
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *SkipListGetData(skiplist_iter_t where);
+
+/* DESCRIPTION:
+ * Function compares between two iterators.
+ *
+ * PARAMS:
+ * iter_one - first iterator to compare
+ * iter_two - second iterator to compare
+ *
+ * RETURN:
+ * 1 when iterators are identical, 0 otherwise.
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+int SkipListIsEqual(skiplist_iter_t iter_one, skiplist_iter_t iter_two);
+
+#endif /* _SKIPLIST_H_ */
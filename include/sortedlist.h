@@ -83,7 +83,8 @@ void SortedListDestroy(sorted_list_t *list);
 int SortedListIsEmpty(const sorted_list_t *list);
 
 /* DESCRIPTION:
- * Function inserts the given data to the list in the correct position.
+ * Function inserts the given data to the list in the correct position -
+ * before any elements equal to it, so equal elements are kept newest first.
  * passing an invalid iterator would result in undefined behaviour.
  *
  * PARAMS:
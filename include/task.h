@@ -48,6 +48,14 @@ UID_t TaskGetUID(const task_t *task);
 
 int TaskCompare(const task_t *task, UID_t uid);
 
+/* orders by UID. a task starts with its UID, so either argument may point
+   to a task or to a UID_t */
+int TaskOrderByUID(const void *uid1, const void *uid2);
+
+void TaskSetHandle(task_t *task, size_t handle);
+
+size_t TaskGetHandle(const task_t *task);
+
 time_t TaskGetNextRunTime(const task_t *task);
 
 void TaskUpdateNextRunTime(task_t *task);
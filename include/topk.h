@@ -0,0 +1,150 @@
+/*
+    team: OL125-126
+    version: 1.0
+    date: 19/10/2026
+*/
+#ifndef _TOPK_H_
+#define _TOPK_H_
+
+#include <stddef.h> /* size_t */
+
+typedef struct topk topk_t;
+
+typedef int (*topk_cmp_t)(const void *data1, const void *data2);
+
+/*
+ * Recommended struct impl:
+ *
+ * struct topk
+ * {
+ *		bin_heap_t *heap;
+ *		size_t k;
+ *		topk_cmp_t cmp;
+ * }
+ *
+ * keeps the k biggest elements by cmp out of a stream of any length.
+ * they are held in a min heap of k elements reserved up front, so an
+ * offer never allocates: while fewer than k are kept the element is
+ * pushed, after that it either replaces the smallest kept element or is
+ * rejected by one compare with it - which is what most of a long stream
+ * gets. an element equal to the smallest kept one is rejected.
+ */
+
+
+/* DESCRIPTION:
+ * Function creates an empty top-k accumulator
+ *
+ * PARAMS:
+ * cmp - compare function, returns positive if data1 is bigger than data2
+ * k   - number of elements to keep, at least 1
+ *
+ * RETURN:
+ * Returns a pointer to the created accumulator, NULL on failure
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(k)
+ */
+topk_t *TopKCreate(topk_cmp_t cmp, size_t k);
+
+/* DESCRIPTION:
+ * Function destroys the accumulator, but not the kept elements
+ *
+ * PARAMS:
+ * topk - pointer to the accumulator to be destroyed
+ *
+ * RETURN:
+ * void
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void TopKDestroy(topk_t *topk);
+
+/* DESCRIPTION:
+ * Function offers an element, keeping it if it is among the k biggest so
+ * far. the element it pushes out, if any, is dropped.
+ *
+ * PARAMS:
+ * topk - pointer to the accumulator
+ * data - the element
+ *
+ * RETURN:
+ * 1 if the element was kept, 0 if it was rejected
+ *
+ * COMPLEXITY:
+ * time: O(1) if rejected, O(log k) if kept
+ * space: O(1)
+ */
+int TopKOffer(topk_t *topk, void *data);
+
+/* DESCRIPTION:
+ * Function offers count elements, as TopKOffer on each. the smallest kept
+ * element is held aside between offers, so a rejection costs a single
+ * compare and nothing else.
+ *
+ * PARAMS:
+ * topk     - pointer to the accumulator
+ * elements - the elements to offer
+ * count    - number of elements
+ *
+ * RETURN:
+ * number of elements kept
+ *
+ * COMPLEXITY:
+ * time: O(count * log k) worst, O(count) when most are rejected
+ * space: O(1)
+ */
+size_t TopKOfferBatch(topk_t *topk, void *elements[], size_t count);
+
+/* DESCRIPTION:
+ * Function returns the smallest kept element - an element has to be
+ * bigger than it to be kept, once k are kept.
+ * calling it on an empty accumulator would result in undefined behaviour.
+ *
+ * PARAMS:
+ * topk - pointer to the accumulator
+ *
+ * RETURN:
+ * the smallest kept element
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+void *TopKThreshold(const topk_t *topk);
+
+/* DESCRIPTION:
+ * Function returns the number of kept elements, at most k
+ *
+ * PARAMS:
+ * topk - pointer to the accumulator
+ *
+ * RETURN:
+ * number of kept elements
+ *
+ * COMPLEXITY:
+ * time: O(1)
+ * space: O(1)
+ */
+size_t TopKSize(const topk_t *topk);
+
+/* DESCRIPTION:
+ * Function moves the kept elements to dest, biggest first, and leaves the
+ * accumulator empty for a new stream.
+ *
+ * PARAMS:
+ * topk - pointer to the accumulator
+ * dest - room for TopKSize(topk) elements
+ *
+ * RETURN:
+ * number of elements written
+ *
+ * COMPLEXITY:
+ * time: O(k * log k)
+ * space: O(1)
+ */
+size_t TopKDrain(topk_t *topk, void *dest[]);
+
+#endif /* _TOPK_H_ */
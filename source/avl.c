@@ -8,6 +8,9 @@
 #define FLIP(x) (((RIGHT) == (x)) ? (LEFT):(RIGHT))
 #define SUCCESS 0
 #define FAIL 1
+/* an avl of height h holds at least fib(h + 2) - 1 nodes, so 64 bit sizes
+   can never get deeper than 92 */
+#define MAX_DEPTH AVL_ITER_DEPTH
 
 /*============================== DECLARATIONS ===============================*/
 
@@ -22,6 +25,7 @@ typedef struct avl_node
 {
     void *data;
     size_t height;
+    size_t size;
     struct avl_node *child[NUM_CHILDREN];
 }avl_node_t;
 
@@ -31,21 +35,26 @@ struct avl
     cmp_func_t cmp_func;
 };
 
-/* Recursive Funcs */
-static avl_node_t *InsertRec(cmp_func_t, avl_node_t*, avl_node_t*);
-static avl_node_t *RemoveRec(avl_node_t*, const void*, cmp_func_t);
-static int ForEachRecPost(action_func_t, avl_node_t*, void*);
-static int ForEachRecPre(action_func_t, avl_node_t*, void*);
-static int ForEachRecIn(action_func_t, avl_node_t*, void*);
-static void *FindRec(cmp_func_t, avl_node_t*, void*);
-static void DestroyNodesRec(avl_node_t*);
-static size_t SizeRec(avl_node_t*);
 /* Helper Funcs */
+static int ForEachPre(action_func_t, avl_node_t*, void*);
+static int ForEachIn(avl_t*, action_func_t, void*);
+static int ForEachPost(action_func_t, avl_node_t*, void*);
+static void IterStep(avl_iter_t*, child_t);
+static void IterPushSpine(avl_iter_t*, avl_node_t*, child_t);
+static void RebalancePath(avl_node_t**[], size_t);
+static avl_node_t *JoinNodes(avl_node_t*, avl_node_t*, avl_node_t*);
+static int BuildRec(void*[], size_t, avl_node_t**);
+static void DestroyNodes(avl_node_t*);
+static long GetHeight(avl_node_t*);
+static void *FindBound(const avl_t*, const void*, int);
+static size_t PushNotSmaller(cmp_func_t, avl_node_t*, const void*, avl_node_t*[], size_t);
+static size_t PushLeftSpine(avl_node_t*, avl_node_t*[], size_t);
 static avl_node_t *RotateSubTree(avl_node_t*, child_t);
 static long GetChildHeight(avl_node_t*, child_t);
-static avl_node_t *FindLeftmost(avl_node_t*);
 static avl_node_t *BalanceNode(avl_node_t*);
 static size_t UpdateNodeHeight(avl_node_t*);
+static size_t UpdateNodeSize(avl_node_t*);
+static size_t GetChildSize(avl_node_t*, child_t);
 static long GetHeightDiff(avl_node_t*);
 static avl_node_t *CreateNode(void*);
 
@@ -64,30 +73,133 @@ avl_t *AVLCreate(cmp_func_t cmp_func)
 	return (tree);
 }
 
+avl_t *AVLCreateFromSorted(cmp_func_t cmp_func, void *elements[], size_t count)
+{
+	avl_t *tree = AVLCreate(cmp_func);
+	assert(NULL != elements || 0 == count);
+	if(NULL != tree && SUCCESS != BuildRec(elements, count, &tree->root))
+	{
+		free(tree);
+		tree = NULL;
+	}
+	return (tree);
+}
+
 void AVLDestroy(avl_t *tree)
 {
 	assert(NULL != tree);
-	DestroyNodesRec(tree->root);
+	DestroyNodes(tree->root);
 	free(tree);
 }
 
 int AVLInsert(avl_t *tree, void *data)
 {
+	avl_node_t **path[MAX_DEPTH];
+	avl_node_t **link = NULL;
 	avl_node_t *new_node = NULL;
+	size_t depth = 0;
 	assert(NULL != tree);
 	new_node = CreateNode(data);
 	if(NULL == new_node)
 	{
 		return (1);
 	}
-	tree->root = InsertRec(tree->cmp_func, tree->root, new_node);
+	for(link = &tree->root; NULL != *link;
+	    link = &(*link)->child[(0 < tree->cmp_func(data, (*link)->data)) ? RIGHT : LEFT])
+	{
+		path[depth++] = link;
+	}
+	*link = new_node;
+	RebalancePath(path, depth);
 	return (0);
 }
 
 void AVLRemove(avl_t *tree, const void *data)
 {
+	avl_node_t **path[MAX_DEPTH];
+	avl_node_t **link = NULL;
+	avl_node_t *node = NULL;
+	int func_rtn = 0;
+	size_t depth = 0;
 	assert(NULL != tree);
-	tree->root = RemoveRec(tree->root, data, tree->cmp_func);
+	link = &tree->root;
+	while(NULL != *link && 0 != (func_rtn = tree->cmp_func(data, (*link)->data)))
+	{
+		path[depth++] = link;
+		link = &(*link)->child[(0 < func_rtn) ? RIGHT : LEFT];
+	}
+	if(NULL == *link)
+	{
+		return;
+	}
+	node = *link;
+	if(NULL != node->child[LEFT] && NULL != node->child[RIGHT])
+	{
+		/* the node keeps its place and takes over its successor's data */
+		path[depth++] = link;
+		link = &node->child[RIGHT];
+		while(NULL != (*link)->child[LEFT])
+		{
+			path[depth++] = link;
+			link = &(*link)->child[LEFT];
+		}
+		node->data = (*link)->data;
+		node = *link;
+	}
+	*link = (NULL == node->child[LEFT]) ? node->child[RIGHT] : node->child[LEFT];
+	free(node);
+	RebalancePath(path, depth);
+}
+
+int AVLJoin(avl_t *left, void *pivot, avl_t *right)
+{
+	avl_node_t *pivot_node = NULL;
+	assert(NULL != left);
+	assert(NULL != right);
+	pivot_node = CreateNode(pivot);
+	if(NULL == pivot_node)
+	{
+		return (1);
+	}
+	left->root = JoinNodes(left->root, pivot_node, right->root);
+	right->root = NULL;
+	return (0);
+}
+
+void AVLSplit(avl_t *tree, const void *key, avl_t *right)
+{
+	avl_node_t *path[MAX_DEPTH];
+	avl_node_t *node = NULL;
+	avl_node_t *child = NULL;
+	avl_node_t *smaller = NULL;
+	avl_node_t *bigger = NULL;
+	size_t depth = 0;
+	assert(NULL != tree);
+	assert(NULL != right);
+	assert(NULL == right->root);
+	for(node = tree->root; NULL != node;
+	    node = node->child[(0 < tree->cmp_func(key, node->data)) ? RIGHT : LEFT])
+	{
+		path[depth++] = node;
+	}
+	/* from the bottom up, every node on the path becomes the pivot that joins
+	   its other subtree to the side it belongs to */
+	while(0 < depth)
+	{
+		node = path[--depth];
+		if(0 < tree->cmp_func(key, node->data))
+		{
+			child = node->child[LEFT];
+			smaller = JoinNodes(child, node, smaller);
+		}
+		else
+		{
+			child = node->child[RIGHT];
+			bigger = JoinNodes(bigger, node, child);
+		}
+	}
+	tree->root = smaller;
+	right->root = bigger;
 }
 
 int AVLIsEmpty(const avl_t *tree)
@@ -99,7 +211,7 @@ int AVLIsEmpty(const avl_t *tree)
 size_t AVLSize(const avl_t *tree)
 {
 	assert(NULL != tree);
-	return (SizeRec(tree->root));
+	return ((NULL == tree->root) ? 0 : tree->root->size);
 }
 
 size_t AVLHeight(const avl_t *tree)
@@ -110,8 +222,105 @@ size_t AVLHeight(const avl_t *tree)
 
 void *AVLFind(const avl_t *tree, const void *data)
 {
+	avl_node_t *node = NULL;
+	int func_rtn = 0;
+	assert(NULL != tree);
+	for(node = tree->root; NULL != node; node = node->child[(0 < func_rtn) ? RIGHT : LEFT])
+	{
+		func_rtn = tree->cmp_func(data, node->data);
+		if(0 == func_rtn)
+		{
+			return (node->data);
+		}
+	}
+	return (NULL);
+}
+
+void *AVLSelect(const avl_t *tree, size_t k)
+{
+	avl_node_t *node = NULL;
+	size_t left_size = 0;
 	assert(NULL != tree);
-	return (FindRec(tree->cmp_func, tree->root, (void *)data));
+	node = tree->root;
+	while(NULL != node)
+	{
+		left_size = GetChildSize(node, LEFT);
+		if(k == left_size)
+		{
+			return (node->data);
+		}
+		if(k < left_size)
+		{
+			node = node->child[LEFT];
+		}
+		else
+		{
+			k -= left_size + 1;
+			node = node->child[RIGHT];
+		}
+	}
+	return (NULL);
+}
+
+size_t AVLRank(const avl_t *tree, const void *key)
+{
+	avl_node_t *node = NULL;
+	size_t rank = 0;
+	assert(NULL != tree);
+	node = tree->root;
+	while(NULL != node)
+	{
+		if(0 < tree->cmp_func(key, node->data))
+		{
+			rank += GetChildSize(node, LEFT) + 1;
+			node = node->child[RIGHT];
+		}
+		else
+		{
+			node = node->child[LEFT];
+		}
+	}
+	return (rank);
+}
+
+void *AVLLowerBound(const avl_t *tree, const void *key)
+{
+	assert(NULL != tree);
+	return (FindBound(tree, key, 0));
+}
+
+void *AVLUpperBound(const avl_t *tree, const void *key)
+{
+	assert(NULL != tree);
+	return (FindBound(tree, key, 1));
+}
+
+int AVLForEachRange(avl_t *tree, const void *from, const void *to,
+                    action_func_t action_func, void *param)
+{
+	avl_node_t *stack[MAX_DEPTH];
+	avl_node_t *node = NULL;
+	size_t depth = 0;
+	assert(NULL != tree);
+	assert(NULL != action_func);
+	/* the stack holds the elements in range whose right subtree is not
+	   visited yet, smallest on top. a right subtree of an element in range
+	   is all not smaller than from, so it needs no compare with it */
+	depth = PushNotSmaller(tree->cmp_func, tree->root, from, stack, 0);
+	while(0 < depth)
+	{
+		node = stack[--depth];
+		if(0 <= tree->cmp_func(node->data, to))
+		{
+			break;
+		}
+		if(SUCCESS != action_func(node->data, param))
+		{
+			return (FAIL);
+		}
+		depth = PushLeftSpine(node->child[RIGHT], stack, depth);
+	}
+	return (SUCCESS);
 }
 
 int AVLForEach(avl_t *tree, action_func_t action_func, void *param, traverse_t type)
@@ -122,134 +331,331 @@ int AVLForEach(avl_t *tree, action_func_t action_func, void *param, traverse_t t
 	switch(type)
 	{
 		case (PRE_ORDER):
-			status = (ForEachRecPre(action_func, tree->root, param));
+			status = ForEachPre(action_func, tree->root, param);
 			break;
 		case (IN_ORDER):
-			status = (ForEachRecIn(action_func, tree->root, param));
+			status = ForEachIn(tree, action_func, param);
 			break;
 		case (POST_ORDER):
-			status = (ForEachRecPost(action_func, tree->root, param));
+			status = ForEachPost(action_func, tree->root, param);
 			break;
 	}
 	return (status);
 }
 
-static void DestroyNodesRec(avl_node_t *node)
+void AVLIterBegin(const avl_t *tree, avl_iter_t *iter)
 {
-	if(NULL == node)
+	assert(NULL != tree);
+	assert(NULL != iter);
+	iter->tree = tree;
+	iter->depth = 0;
+	IterPushSpine(iter, tree->root, LEFT);
+}
+
+void AVLIterEnd(const avl_t *tree, avl_iter_t *iter)
+{
+	assert(NULL != tree);
+	assert(NULL != iter);
+	iter->tree = tree;
+	iter->depth = 0;
+}
+
+void AVLIterNext(avl_iter_t *iter)
+{
+	assert(NULL != iter);
+	IterStep(iter, RIGHT);
+}
+
+void AVLIterPrev(avl_iter_t *iter)
+{
+	assert(NULL != iter);
+	IterStep(iter, LEFT);
+}
+
+int AVLIterIsEnd(const avl_iter_t *iter)
+{
+	assert(NULL != iter);
+	return (0 == iter->depth);
+}
+
+void *AVLIterGetData(const avl_iter_t *iter)
+{
+	assert(NULL != iter);
+	assert(0 < iter->depth);
+	return (((const avl_node_t*)iter->path[iter->depth - 1])->data);
+}
+
+/* moves to the next node in the given direction. from the end it wraps to
+   the first node in that direction, past the last one it reaches the end */
+static void IterStep(avl_iter_t *iter, child_t direction)
+{
+	const avl_node_t *child = NULL;
+	const avl_node_t *node = NULL;
+	if(0 == iter->depth)
 	{
+		IterPushSpine(iter, iter->tree->root, FLIP(direction));
 		return;
 	}
-	DestroyNodesRec(node->child[LEFT]);
-	node->child[LEFT] = NULL;
-	DestroyNodesRec(node->child[RIGHT]);
-	node->child[RIGHT] = NULL;
-	free(node);
+	node = (const avl_node_t*)iter->path[iter->depth - 1];
+	if(NULL != node->child[direction])
+	{
+		IterPushSpine(iter, node->child[direction], FLIP(direction));
+		return;
+	}
+	/* climbs while coming up from the given side */
+	do
+	{
+		child = (const avl_node_t*)iter->path[--iter->depth];
+	}
+	while(0 < iter->depth &&
+	      child == ((const avl_node_t*)iter->path[iter->depth - 1])->child[direction]);
 }
 
-static avl_node_t *InsertRec(cmp_func_t cmp_func, avl_node_t *node, avl_node_t *to_insert)
+/* pushes node and its descendants all the way to the given side */
+static void IterPushSpine(avl_iter_t *iter, avl_node_t *node, child_t direction)
 {
-	if(NULL == node)
+	for(; NULL != node; node = node->child[direction])
 	{
-		return (to_insert);
+		iter->path[iter->depth++] = node;
 	}
-	if(0 < cmp_func(to_insert->data, node->data))
+}
+
+static int ForEachPre(action_func_t action_func, avl_node_t *node, void *param)
+{
+	avl_node_t *stack[MAX_DEPTH];
+	size_t depth = 0;
+	/* goes left first, and keeps the right children for later */
+	while(NULL != node)
 	{
-		node->child[RIGHT] = InsertRec(cmp_func, node->child[RIGHT], to_insert);		
+		if(SUCCESS != action_func(node->data, param))
+		{
+			return (FAIL);
+		}
+		if(NULL != node->child[RIGHT])
+		{
+			stack[depth++] = node->child[RIGHT];
+		}
+		node = node->child[LEFT];
+		if(NULL == node && 0 < depth)
+		{
+			node = stack[--depth];
+		}
 	}
-	else
+	return (SUCCESS);
+}
+
+static int ForEachIn(avl_t *tree, action_func_t action_func, void *param)
+{
+	avl_iter_t iter;
+	for(AVLIterBegin(tree, &iter); !AVLIterIsEnd(&iter); AVLIterNext(&iter))
 	{
-		node->child[LEFT] = InsertRec(cmp_func, node->child[LEFT], to_insert);		
+		if(SUCCESS != action_func(AVLIterGetData(&iter), param))
+		{
+			return (FAIL);
+		}
 	}
-	node->height = UpdateNodeHeight(node);
-	return (BalanceNode(node));
+	return (SUCCESS);
 }
 
-static avl_node_t *RemoveRec(avl_node_t *node, const void *data, cmp_func_t cmp_func)
+static int ForEachPost(action_func_t action_func, avl_node_t *node, void *param)
 {
-	int func_rtn = 0;
-	if (NULL == node)
+	avl_node_t *stack[MAX_DEPTH];
+	avl_node_t *last = NULL;
+	size_t depth = 0;
+	while(NULL != node || 0 < depth)
 	{
-		return (node);
-	}
-	func_rtn = cmp_func(data, node->data);
-	if (0 > func_rtn)
-	{    
-		node->child[LEFT] = RemoveRec(node->child[LEFT], data, cmp_func);
+		for(; NULL != node; node = node->child[LEFT])
+		{
+			stack[depth++] = node;
+		}
+		node = stack[depth - 1];
+		/* a node is visited once its right subtree is done */
+		if(NULL != node->child[RIGHT] && last != node->child[RIGHT])
+		{
+			node = node->child[RIGHT];
+			continue;
+		}
+		if(SUCCESS != action_func(node->data, param))
+		{
+			return (FAIL);
+		}
+		last = node;
+		node = NULL;
+		--depth;
 	}
-	else if (0 < func_rtn)
+	return (SUCCESS);
+}
+
+/* first element not smaller than key, or bigger than it when is_upper */
+static void *FindBound(const avl_t *tree, const void *key, int is_upper)
+{
+	avl_node_t *node = tree->root;
+	void *bound = NULL;
+	int func_rtn = 0;
+	while(NULL != node)
 	{
-		node->child[RIGHT] = RemoveRec(node->child[RIGHT], data, cmp_func);
-	} 
-	else 
+		func_rtn = tree->cmp_func(key, node->data);
+		if(0 > func_rtn || (0 == func_rtn && !is_upper))
+		{
+			bound = node->data;
+			node = node->child[LEFT];
+		}
+		else
+		{
+			node = node->child[RIGHT];
+		}
+	}
+	return (bound);
+}
+
+/* pushes the nodes of the subtree that are not smaller than key and whose
+   left subtree may still hold such nodes, the smallest ends on top */
+static size_t PushNotSmaller(cmp_func_t cmp_func, avl_node_t *node,
+                             const void *key, avl_node_t *stack[], size_t depth)
+{
+	while(NULL != node)
 	{
-		avl_node_t *temp = NULL;
-		if(NULL == node->child[LEFT] || NULL == node->child[RIGHT])
+		if(0 > cmp_func(node->data, key))
+		{
+			node = node->child[RIGHT];
+		}
+		else
 		{
-			temp = ((NULL == node->child[LEFT]) ? node->child[RIGHT] : node->child[LEFT]);
-			free(node);
-			return (temp);
+			stack[depth++] = node;
+			node = node->child[LEFT];
 		}
-		temp = FindLeftmost(node->child[RIGHT]);
-		node->data = temp->data;
-		node->child[RIGHT] = RemoveRec(node->child[RIGHT], temp->data, cmp_func);
 	}
-	node->height = UpdateNodeHeight(node);
-	return (BalanceNode(node));
+	return (depth);
 }
 
-static size_t SizeRec(avl_node_t *node)
+/* pushes node and its left descendants, the smallest ends on top */
+static size_t PushLeftSpine(avl_node_t *node, avl_node_t *stack[], size_t depth)
 {
-	return ((NULL == node) ? 0 : (1 + SizeRec(node->child[RIGHT]) + SizeRec(node->child[LEFT])));
+	while(NULL != node)
+	{
+		stack[depth++] = node;
+		node = node->child[LEFT];
+	}
+	return (depth);
 }
 
-static void *FindRec(cmp_func_t cmp_func, avl_node_t *node, void *data)
+/* hangs left and right under pivot, on the side of the taller one, where
+   the heights meet. all of left must be smaller than pivot and all of right
+   not smaller. O(difference in heights) */
+static avl_node_t *JoinNodes(avl_node_t *left, avl_node_t *pivot, avl_node_t *right)
 {
-	int func_rtn = 0;
-	if(NULL == node)
+	avl_node_t **path[MAX_DEPTH];
+	avl_node_t **link = NULL;
+	avl_node_t *root = NULL;
+	child_t side = LEFT;
+	long target = 0;
+	size_t depth = 0;
+	if(GetHeight(left) > GetHeight(right) + 1)
+	{
+		root = left;
+		side = RIGHT;
+		target = GetHeight(right) + 1;
+	}
+	else if(GetHeight(right) > GetHeight(left) + 1)
+	{
+		root = right;
+		side = LEFT;
+		target = GetHeight(left) + 1;
+	}
+	/* walks down the inner spine of the taller tree */
+	for(link = &root; GetHeight(*link) > target; link = &(*link)->child[side])
 	{
-		return (node);
+		path[depth++] = link;
 	}
-	func_rtn = cmp_func(data, node->data);
-	if(0 == func_rtn)
+	if(NULL == root)
 	{
-		return (node->data);
+		pivot->child[LEFT] = left;
+		pivot->child[RIGHT] = right;
 	}
-	if(0 < func_rtn)
+	else
 	{
-		return FindRec(cmp_func, node->child[RIGHT], data);
+		pivot->child[FLIP(side)] = *link;
+		pivot->child[side] = (RIGHT == side) ? right : left;
 	}
-	return (FindRec(cmp_func, node->child[LEFT], data));
+	pivot->height = UpdateNodeHeight(pivot);
+	pivot->size = UpdateNodeSize(pivot);
+	*link = pivot;
+	RebalancePath(path, depth);
+	return (root);
 }
 
-static int ForEachRecPre(action_func_t action_func, avl_node_t *node, void *param)
+/* the middle element is the root, so depth stays at log(count) */
+static int BuildRec(void *elements[], size_t count, avl_node_t **out)
 {
-	return (
-	(NULL == node) ? (SUCCESS) :
-	(SUCCESS != action_func(node->data, param)) ? (FAIL) :
-	(SUCCESS != ForEachRecPre(action_func, node->child[LEFT], param)) ? (FAIL) :
-	(SUCCESS != ForEachRecPre(action_func, node->child[RIGHT], param)) ? (FAIL) :
-	(SUCCESS));
+	size_t middle = count / 2;
+	avl_node_t *node = NULL;
+	*out = NULL;
+	if(0 == count)
+	{
+		return (SUCCESS);
+	}
+	node = CreateNode(elements[middle]);
+	if(NULL == node)
+	{
+		return (FAIL);
+	}
+	if(SUCCESS != BuildRec(elements, middle, &node->child[LEFT]) ||
+	   SUCCESS != BuildRec(elements + middle + 1, count - middle - 1, &node->child[RIGHT]))
+	{
+		DestroyNodes(node);
+		return (FAIL);
+	}
+	node->height = UpdateNodeHeight(node);
+	node->size = UpdateNodeSize(node);
+	*out = node;
+	return (SUCCESS);
 }
 
-static int ForEachRecIn(action_func_t action_func, avl_node_t *node, void *param)
+static void DestroyNodes(avl_node_t *node)
 {
-	return (
-	(NULL == node) ? (SUCCESS) :
-	(SUCCESS != ForEachRecPre(action_func, node->child[LEFT], param)) ? (FAIL) :
-	(SUCCESS != action_func(node->data, param)) ? (FAIL) :
-	(SUCCESS != ForEachRecPre(action_func, node->child[RIGHT], param)) ? (FAIL) :
-	(SUCCESS));
+	avl_node_t *stack[MAX_DEPTH];
+	avl_node_t *next = NULL;
+	size_t depth = 0;
+	/* walks down the left spine and stacks the right children on the way */
+	for(; NULL != node; node = next)
+	{
+		if(NULL != node->child[RIGHT])
+		{
+			stack[depth++] = node->child[RIGHT];
+		}
+		next = node->child[LEFT];
+		free(node);
+		if(NULL == next && 0 < depth)
+		{
+			next = stack[--depth];
+		}
+	}
 }
 
-static int ForEachRecPost(action_func_t action_func, avl_node_t *node, void *param)
+/* fixes heights and balance from the deepest link on the path up. once a
+   subtree is back to the height it had before the change only the sizes
+   above it are left to fix */
+static void RebalancePath(avl_node_t **path[], size_t depth)
 {
-	return (
-	(NULL == node) ? (SUCCESS) :
-	(SUCCESS != ForEachRecPre(action_func, node->child[LEFT], param)) ? (FAIL) :
-	(SUCCESS != ForEachRecPre(action_func, node->child[RIGHT], param)) ? (FAIL) :
-	(SUCCESS != action_func(node->data, param)) ? (FAIL) :
-	(SUCCESS));
+	avl_node_t *node = NULL;
+	size_t old_height = 0;
+	while(0 < depth)
+	{
+		node = *path[--depth];
+		old_height = node->height;
+		node->height = UpdateNodeHeight(node);
+		node->size = UpdateNodeSize(node);
+		*path[depth] = BalanceNode(node);
+		if((*path[depth])->height == old_height)
+		{
+			break;
+		}
+	}
+	while(0 < depth)
+	{
+		node = *path[--depth];
+		node->size = UpdateNodeSize(node);
+	}
 }
 
 static avl_node_t *BalanceNode(avl_node_t *node)
@@ -281,6 +687,8 @@ static avl_node_t *RotateSubTree(avl_node_t *node, child_t direction)
 	new_root->child[direction] = node;
 	node->height = UpdateNodeHeight(node);
 	new_root->height = UpdateNodeHeight(new_root);
+	node->size = UpdateNodeSize(node);
+	new_root->size = UpdateNodeSize(new_root);
 	return (new_root);
 }
 
@@ -294,14 +702,24 @@ static size_t UpdateNodeHeight(avl_node_t *node)
 	return (MAX(GetChildHeight(node, LEFT), GetChildHeight(node, RIGHT)) + 1);
 }
 
+static size_t UpdateNodeSize(avl_node_t *node)
+{
+	return (GetChildSize(node, LEFT) + GetChildSize(node, RIGHT) + 1);
+}
+
+static size_t GetChildSize(avl_node_t *node, child_t direction)
+{
+	return ((NULL == node->child[direction]) ? 0 : node->child[direction]->size);
+}
+
 static long GetChildHeight(avl_node_t *node, child_t direction)
 {
-	return ((NULL == node->child[direction]) ? 0 : node->child[direction]->height);
+	return (GetHeight(node->child[direction]));
 }
 
-static avl_node_t *FindLeftmost(avl_node_t *node)
+static long GetHeight(avl_node_t *node)
 {
-	return ((NULL == node->child[LEFT]) ? node : FindLeftmost(node->child[LEFT]));
+	return ((NULL == node) ? 0 : (long)node->height);
 }
 
 static avl_node_t *CreateNode(void *data)
@@ -311,6 +729,7 @@ static avl_node_t *CreateNode(void *data)
 	{
 		new_node->data = data;
 		new_node->height = 1;
+		new_node->size = 1;
 		new_node->child[LEFT] = NULL;
 		new_node->child[RIGHT] = NULL;
 	}
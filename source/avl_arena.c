@@ -0,0 +1,342 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#include <stdlib.h> /* malloc, realloc, free */
+#include <stdint.h> /* uint32_t, UINT32_MAX */
+#include <assert.h> /* assert */
+
+#include "../include/avl_arena.h"
+
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#define FLIP(x) (((RIGHT) == (x)) ? (LEFT):(RIGHT))
+#define SUCCESS 0
+#define FAIL 1
+/* index 0 is a sentinel with height and size 0 that stands for "no node" */
+#define NIL 0
+#define MAX_DEPTH 96
+#define MIN_CAPACITY 16
+
+/*============================== DECLARATIONS ===============================*/
+
+typedef enum child
+{
+	LEFT = 0,
+	RIGHT,
+	NUM_CHILDREN
+}child_t;
+
+typedef struct avl_arena_node
+{
+	void *data;
+	uint32_t child[NUM_CHILDREN];
+	uint32_t size;
+	unsigned char height;
+}avl_arena_node_t;
+
+struct avl_arena
+{
+	avl_arena_node_t *nodes;
+	uint32_t capacity;
+	uint32_t next_unused;
+	uint32_t free_list;
+	uint32_t root;
+	cmp_func_t cmp_func;
+};
+
+static uint32_t AllocNode(avl_arena_t*, void*);
+static void FreeNode(avl_arena_t*, uint32_t);
+static int Grow(avl_arena_t*);
+static void RebalancePath(avl_arena_node_t*, uint32_t*[], size_t);
+static uint32_t BalanceNode(avl_arena_node_t*, uint32_t);
+static uint32_t RotateSubTree(avl_arena_node_t*, uint32_t, child_t);
+static void UpdateNode(avl_arena_node_t*, uint32_t);
+static int GetHeightDiff(avl_arena_node_t*, uint32_t);
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+avl_arena_t *AVLArenaCreate(cmp_func_t cmp_func, size_t capacity)
+{
+	avl_arena_t *tree = NULL;
+	assert(NULL != cmp_func);
+	tree = (avl_arena_t*) malloc(sizeof(avl_arena_t));
+	if(NULL == tree)
+	{
+		return (NULL);
+	}
+	/* one more for the sentinel */
+	capacity = MAX(capacity + 1, MIN_CAPACITY);
+	tree->capacity = (capacity < UINT32_MAX) ? (uint32_t)capacity : UINT32_MAX;
+	tree->nodes = (avl_arena_node_t*) malloc(tree->capacity * sizeof(avl_arena_node_t));
+	if(NULL == tree->nodes)
+	{
+		free(tree);
+		return (NULL);
+	}
+	tree->nodes[NIL].data = NULL;
+	tree->nodes[NIL].child[LEFT] = NIL;
+	tree->nodes[NIL].child[RIGHT] = NIL;
+	tree->nodes[NIL].size = 0;
+	tree->nodes[NIL].height = 0;
+	tree->cmp_func = cmp_func;
+	AVLArenaClear(tree);
+	return (tree);
+}
+
+void AVLArenaDestroy(avl_arena_t *tree)
+{
+	assert(NULL != tree);
+	free(tree->nodes);
+	free(tree);
+}
+
+void AVLArenaClear(avl_arena_t *tree)
+{
+	assert(NULL != tree);
+	tree->next_unused = NIL + 1;
+	tree->free_list = NIL;
+	tree->root = NIL;
+}
+
+int AVLArenaInsert(avl_arena_t *tree, void *data)
+{
+	uint32_t *path[MAX_DEPTH];
+	uint32_t *link = NULL;
+	avl_arena_node_t *nodes = NULL;
+	uint32_t index = NIL;
+	size_t depth = 0;
+	assert(NULL != tree);
+	/* allocate first - growing may move the array the path points into */
+	index = AllocNode(tree, data);
+	if(NIL == index)
+	{
+		return (FAIL);
+	}
+	nodes = tree->nodes;
+	for(link = &tree->root; NIL != *link;
+	    link = &nodes[*link].child[(0 < tree->cmp_func(data, nodes[*link].data)) ? RIGHT : LEFT])
+	{
+		path[depth++] = link;
+	}
+	*link = index;
+	RebalancePath(nodes, path, depth);
+	return (SUCCESS);
+}
+
+void AVLArenaRemove(avl_arena_t *tree, const void *key)
+{
+	uint32_t *path[MAX_DEPTH];
+	uint32_t *link = NULL;
+	avl_arena_node_t *nodes = NULL;
+	uint32_t index = NIL;
+	int func_rtn = 0;
+	size_t depth = 0;
+	assert(NULL != tree);
+	nodes = tree->nodes;
+	link = &tree->root;
+	while(NIL != *link && 0 != (func_rtn = tree->cmp_func(key, nodes[*link].data)))
+	{
+		path[depth++] = link;
+		link = &nodes[*link].child[(0 < func_rtn) ? RIGHT : LEFT];
+	}
+	if(NIL == *link)
+	{
+		return;
+	}
+	index = *link;
+	if(NIL != nodes[index].child[LEFT] && NIL != nodes[index].child[RIGHT])
+	{
+		/* the node keeps its place and takes over its successor's data */
+		path[depth++] = link;
+		link = &nodes[index].child[RIGHT];
+		while(NIL != nodes[*link].child[LEFT])
+		{
+			path[depth++] = link;
+			link = &nodes[*link].child[LEFT];
+		}
+		nodes[index].data = nodes[*link].data;
+		index = *link;
+	}
+	*link = (NIL == nodes[index].child[LEFT]) ? nodes[index].child[RIGHT] : nodes[index].child[LEFT];
+	FreeNode(tree, index);
+	RebalancePath(nodes, path, depth);
+}
+
+void *AVLArenaFind(const avl_arena_t *tree, const void *key)
+{
+	const avl_arena_node_t *nodes = NULL;
+	uint32_t index = NIL;
+	int func_rtn = 0;
+	assert(NULL != tree);
+	nodes = tree->nodes;
+	for(index = tree->root; NIL != index; index = nodes[index].child[(0 < func_rtn) ? RIGHT : LEFT])
+	{
+		func_rtn = tree->cmp_func(key, nodes[index].data);
+		if(0 == func_rtn)
+		{
+			return (nodes[index].data);
+		}
+	}
+	return (NULL);
+}
+
+size_t AVLArenaSize(const avl_arena_t *tree)
+{
+	assert(NULL != tree);
+	return (tree->nodes[tree->root].size);
+}
+
+int AVLArenaIsEmpty(const avl_arena_t *tree)
+{
+	assert(NULL != tree);
+	return (NIL == tree->root);
+}
+
+size_t AVLArenaHeight(const avl_arena_t *tree)
+{
+	assert(NULL != tree);
+	return (tree->nodes[tree->root].height);
+}
+
+int AVLArenaForEach(avl_arena_t *tree, action_func_t action_func, void *param)
+{
+	uint32_t stack[MAX_DEPTH];
+	avl_arena_node_t *nodes = NULL;
+	uint32_t index = NIL;
+	size_t depth = 0;
+	assert(NULL != tree);
+	assert(NULL != action_func);
+	nodes = tree->nodes;
+	for(index = tree->root; NIL != index || 0 < depth; index = nodes[index].child[RIGHT])
+	{
+		for(; NIL != index; index = nodes[index].child[LEFT])
+		{
+			stack[depth++] = index;
+		}
+		index = stack[--depth];
+		if(SUCCESS != action_func(nodes[index].data, param))
+		{
+			return (FAIL);
+		}
+	}
+	return (SUCCESS);
+}
+
+/* takes a node off the free list, or the next never used one */
+static uint32_t AllocNode(avl_arena_t *tree, void *data)
+{
+	avl_arena_node_t *node = NULL;
+	uint32_t index = tree->free_list;
+	if(NIL != index)
+	{
+		tree->free_list = tree->nodes[index].child[LEFT];
+	}
+	else
+	{
+		if(tree->next_unused == tree->capacity && SUCCESS != Grow(tree))
+		{
+			return (NIL);
+		}
+		index = tree->next_unused++;
+	}
+	node = &tree->nodes[index];
+	node->data = data;
+	node->child[LEFT] = NIL;
+	node->child[RIGHT] = NIL;
+	node->size = 1;
+	node->height = 1;
+	return (index);
+}
+
+/* the free list is threaded through the left links */
+static void FreeNode(avl_arena_t *tree, uint32_t index)
+{
+	tree->nodes[index].child[LEFT] = tree->free_list;
+	tree->free_list = index;
+}
+
+static int Grow(avl_arena_t *tree)
+{
+	avl_arena_node_t *nodes = NULL;
+	uint32_t capacity = (tree->capacity <= UINT32_MAX / 2) ? tree->capacity * 2 : UINT32_MAX;
+	if(capacity == tree->capacity)
+	{
+		return (FAIL);
+	}
+	nodes = (avl_arena_node_t*) realloc(tree->nodes, capacity * sizeof(avl_arena_node_t));
+	if(NULL == nodes)
+	{
+		return (FAIL);
+	}
+	tree->nodes = nodes;
+	tree->capacity = capacity;
+	return (SUCCESS);
+}
+
+/* fixes heights, sizes and balance from the deepest link on the path up.
+   once a subtree is back to its old height only the sizes are left */
+static void RebalancePath(avl_arena_node_t *nodes, uint32_t *path[], size_t depth)
+{
+	unsigned char old_height = 0;
+	while(0 < depth)
+	{
+		--depth;
+		old_height = nodes[*path[depth]].height;
+		UpdateNode(nodes, *path[depth]);
+		*path[depth] = BalanceNode(nodes, *path[depth]);
+		if(nodes[*path[depth]].height == old_height)
+		{
+			break;
+		}
+	}
+	while(0 < depth)
+	{
+		--depth;
+		UpdateNode(nodes, *path[depth]);
+	}
+}
+
+static uint32_t BalanceNode(avl_arena_node_t *nodes, uint32_t index)
+{
+	int height_diff = GetHeightDiff(nodes, index);
+	avl_arena_node_t *node = &nodes[index];
+	if(height_diff > 1)
+	{
+		if(GetHeightDiff(nodes, node->child[LEFT]) < 0)
+		{
+			node->child[LEFT] = RotateSubTree(nodes, node->child[LEFT], LEFT);
+		}
+		return (RotateSubTree(nodes, index, RIGHT));
+	}
+	if(height_diff < -1)
+	{
+		if(GetHeightDiff(nodes, node->child[RIGHT]) > 0)
+		{
+			node->child[RIGHT] = RotateSubTree(nodes, node->child[RIGHT], RIGHT);
+		}
+		return (RotateSubTree(nodes, index, LEFT));
+	}
+	return (index);
+}
+
+static uint32_t RotateSubTree(avl_arena_node_t *nodes, uint32_t index, child_t direction)
+{
+	uint32_t new_root = nodes[index].child[FLIP(direction)];
+	nodes[index].child[FLIP(direction)] = nodes[new_root].child[direction];
+	nodes[new_root].child[direction] = index;
+	UpdateNode(nodes, index);
+	UpdateNode(nodes, new_root);
+	return (new_root);
+}
+
+static void UpdateNode(avl_arena_node_t *nodes, uint32_t index)
+{
+	avl_arena_node_t *node = &nodes[index];
+	node->height = (unsigned char)(MAX(nodes[node->child[LEFT]].height,
+	                                   nodes[node->child[RIGHT]].height) + 1);
+	node->size = nodes[node->child[LEFT]].size + nodes[node->child[RIGHT]].size + 1;
+}
+
+static int GetHeightDiff(avl_arena_node_t *nodes, uint32_t index)
+{
+	return ((int)nodes[nodes[index].child[LEFT]].height -
+	        (int)nodes[nodes[index].child[RIGHT]].height);
+}
@@ -0,0 +1,379 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#include <stdlib.h> /* malloc, free */
+#include <assert.h> /* assert */
+
+#include "../include/avl_persist.h"
+
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#define FLIP(x) (((RIGHT) == (x)) ? (LEFT):(RIGHT))
+#define SUCCESS 0
+#define FAIL 1
+#define MAX_DEPTH 96
+/* rebuilding one level makes at most 3 nodes (a double rotation) */
+#define NODES_PER_LEVEL 3
+#define MAX_SPARES (NODES_PER_LEVEL * (MAX_DEPTH + 1))
+
+/*============================== DECLARATIONS ===============================*/
+
+typedef enum child
+{
+	LEFT = 0,
+	RIGHT,
+	NUM_CHILDREN
+}child_t;
+
+typedef struct avl_persist_node
+{
+	void *data;
+	size_t refs;
+	size_t height;
+	size_t size;
+	struct avl_persist_node *child[NUM_CHILDREN];
+}avl_persist_node_t;
+
+struct avl_persist
+{
+	avl_persist_node_t *root;
+	cmp_func_t cmp_func;
+	avl_persist_node_t *spares;
+	size_t num_spares;
+};
+
+static avl_persist_node_t *Rebuild(avl_persist_t*, const avl_persist_node_t*[], child_t[],
+                                   size_t, avl_persist_node_t*, size_t, void*);
+static avl_persist_node_t *Balance(avl_persist_t*, void*, avl_persist_node_t*, avl_persist_node_t*);
+static avl_persist_node_t *MakeSided(avl_persist_t*, void*, child_t,
+                                     avl_persist_node_t*, avl_persist_node_t*);
+static avl_persist_node_t *MakeNode(avl_persist_t*, void*, avl_persist_node_t*, avl_persist_node_t*);
+static avl_persist_node_t *IncRef(avl_persist_node_t*);
+static void Release(avl_persist_t*, avl_persist_node_t*);
+static int FillSpares(avl_persist_t*, size_t);
+static void FreeNode(avl_persist_t*, avl_persist_node_t*);
+static long GetHeight(const avl_persist_node_t*);
+static size_t GetSize(const avl_persist_node_t*);
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+avl_persist_t *AVLPersistCreate(cmp_func_t cmp_func)
+{
+	avl_persist_t *tree = NULL;
+	assert(NULL != cmp_func);
+	tree = (avl_persist_t*) malloc(sizeof(avl_persist_t));
+	if(NULL != tree)
+	{
+		tree->root = NULL;
+		tree->cmp_func = cmp_func;
+		tree->spares = NULL;
+		tree->num_spares = 0;
+	}
+	return (tree);
+}
+
+void AVLPersistDestroy(avl_persist_t *tree)
+{
+	avl_persist_node_t *next = NULL;
+	assert(NULL != tree);
+	Release(tree, tree->root);
+	for(; NULL != tree->spares; tree->spares = next)
+	{
+		next = tree->spares->child[LEFT];
+		free(tree->spares);
+	}
+	free(tree);
+}
+
+avl_persist_t *AVLPersistSnapshot(const avl_persist_t *tree)
+{
+	avl_persist_t *snapshot = NULL;
+	assert(NULL != tree);
+	snapshot = AVLPersistCreate(tree->cmp_func);
+	if(NULL != snapshot)
+	{
+		snapshot->root = IncRef(tree->root);
+	}
+	return (snapshot);
+}
+
+int AVLPersistInsert(avl_persist_t *tree, void *data)
+{
+	const avl_persist_node_t *path[MAX_DEPTH];
+	child_t directions[MAX_DEPTH];
+	const avl_persist_node_t *node = NULL;
+	avl_persist_node_t *old_root = NULL;
+	size_t depth = 0;
+	assert(NULL != tree);
+	/* every allocation is done first, so nothing below can fail */
+	if(SUCCESS != FillSpares(tree, NODES_PER_LEVEL * (GetHeight(tree->root) + 1)))
+	{
+		return (FAIL);
+	}
+	for(node = tree->root; NULL != node; node = node->child[directions[depth++]])
+	{
+		path[depth] = node;
+		directions[depth] = (0 < tree->cmp_func(data, node->data)) ? RIGHT : LEFT;
+	}
+	old_root = tree->root;
+	tree->root = Rebuild(tree, path, directions, depth, MakeNode(tree, data, NULL, NULL), MAX_DEPTH, NULL);
+	Release(tree, old_root);
+	return (SUCCESS);
+}
+
+int AVLPersistRemove(avl_persist_t *tree, const void *key)
+{
+	const avl_persist_node_t *path[MAX_DEPTH];
+	child_t directions[MAX_DEPTH];
+	const avl_persist_node_t *node = NULL;
+	avl_persist_node_t *old_root = NULL;
+	avl_persist_node_t *sub_tree = NULL;
+	void *successor_data = NULL;
+	size_t found_depth = 0;
+	size_t depth = 0;
+	int func_rtn = 0;
+	assert(NULL != tree);
+	node = tree->root;
+	while(NULL != node && 0 != (func_rtn = tree->cmp_func(key, node->data)))
+	{
+		path[depth] = node;
+		directions[depth] = (0 < func_rtn) ? RIGHT : LEFT;
+		node = node->child[directions[depth++]];
+	}
+	if(NULL == node)
+	{
+		return (SUCCESS);
+	}
+	if(SUCCESS != FillSpares(tree, NODES_PER_LEVEL * GetHeight(tree->root)))
+	{
+		return (FAIL);
+	}
+	found_depth = depth;
+	if(NULL != node->child[LEFT] && NULL != node->child[RIGHT])
+	{
+		/* the successor is taken out of the right subtree instead, and its
+		   data goes in the copy of the found node */
+		path[depth] = node;
+		directions[depth++] = RIGHT;
+		for(node = node->child[RIGHT]; NULL != node->child[LEFT]; node = node->child[LEFT])
+		{
+			path[depth] = node;
+			directions[depth++] = LEFT;
+		}
+		successor_data = node->data;
+	}
+	sub_tree = IncRef((NULL == node->child[LEFT]) ? node->child[RIGHT] : node->child[LEFT]);
+	old_root = tree->root;
+	tree->root = Rebuild(tree, path, directions, depth, sub_tree, found_depth, successor_data);
+	Release(tree, old_root);
+	return (SUCCESS);
+}
+
+void *AVLPersistFind(const avl_persist_t *tree, const void *key)
+{
+	const avl_persist_node_t *node = NULL;
+	int func_rtn = 0;
+	assert(NULL != tree);
+	for(node = tree->root; NULL != node; node = node->child[(0 < func_rtn) ? RIGHT : LEFT])
+	{
+		func_rtn = tree->cmp_func(key, node->data);
+		if(0 == func_rtn)
+		{
+			return (node->data);
+		}
+	}
+	return (NULL);
+}
+
+size_t AVLPersistSize(const avl_persist_t *tree)
+{
+	assert(NULL != tree);
+	return (GetSize(tree->root));
+}
+
+int AVLPersistIsEmpty(const avl_persist_t *tree)
+{
+	assert(NULL != tree);
+	return (NULL == tree->root);
+}
+
+size_t AVLPersistHeight(const avl_persist_t *tree)
+{
+	assert(NULL != tree);
+	return ((size_t)GetHeight(tree->root));
+}
+
+int AVLPersistForEach(const avl_persist_t *tree, action_func_t action_func, void *param)
+{
+	const avl_persist_node_t *stack[MAX_DEPTH];
+	const avl_persist_node_t *node = NULL;
+	size_t depth = 0;
+	assert(NULL != tree);
+	assert(NULL != action_func);
+	for(node = tree->root; NULL != node || 0 < depth; node = node->child[RIGHT])
+	{
+		for(; NULL != node; node = node->child[LEFT])
+		{
+			stack[depth++] = node;
+		}
+		node = stack[--depth];
+		if(SUCCESS != action_func(node->data, param))
+		{
+			return (FAIL);
+		}
+	}
+	return (SUCCESS);
+}
+
+/* builds new copies of the path nodes from the bottom up, each one over the
+   new subtree below it and its old subtree on the other side. the node at
+   swap_depth gets swap_data instead of its own */
+static avl_persist_node_t *Rebuild(avl_persist_t *tree, const avl_persist_node_t *path[],
+                                   child_t directions[], size_t depth,
+                                   avl_persist_node_t *sub_tree, size_t swap_depth, void *swap_data)
+{
+	avl_persist_node_t *other = NULL;
+	void *data = NULL;
+	while(0 < depth)
+	{
+		--depth;
+		other = IncRef(path[depth]->child[FLIP(directions[depth])]);
+		data = (depth == swap_depth) ? swap_data : path[depth]->data;
+		sub_tree = (LEFT == directions[depth]) ? Balance(tree, data, sub_tree, other) :
+		                                         Balance(tree, data, other, sub_tree);
+	}
+	return (sub_tree);
+}
+
+/* makes a node of data over left and right, rotating when their heights
+   are 2 apart. rotations build new nodes and leave the old ones as they
+   are, since other versions may be using them. takes over the references
+   to left and right */
+static avl_persist_node_t *Balance(avl_persist_t *tree, void *data,
+                                   avl_persist_node_t *left, avl_persist_node_t *right)
+{
+	avl_persist_node_t *heavy = NULL;
+	avl_persist_node_t *inner = NULL;
+	avl_persist_node_t *light = NULL;
+	avl_persist_node_t *new_root = NULL;
+	long height_diff = GetHeight(left) - GetHeight(right);
+	child_t side = LEFT;
+	if(1 >= height_diff && -1 <= height_diff)
+	{
+		return (MakeNode(tree, data, left, right));
+	}
+	side = (1 < height_diff) ? LEFT : RIGHT;
+	heavy = (LEFT == side) ? left : right;
+	light = (LEFT == side) ? right : left;
+	inner = heavy->child[FLIP(side)];
+	if(GetHeight(heavy->child[side]) >= GetHeight(inner))
+	{
+		new_root = MakeSided(tree, heavy->data, side, IncRef(heavy->child[side]),
+		                     MakeSided(tree, data, side, IncRef(inner), light));
+	}
+	else
+	{
+		new_root = MakeSided(tree, inner->data, side,
+		                     MakeSided(tree, heavy->data, side, IncRef(heavy->child[side]),
+		                               IncRef(inner->child[side])),
+		                     MakeSided(tree, data, side, IncRef(inner->child[FLIP(side)]), light));
+	}
+	Release(tree, heavy);
+	return (new_root);
+}
+
+/* a node with side_child on the given side and other_child on the other */
+static avl_persist_node_t *MakeSided(avl_persist_t *tree, void *data, child_t side,
+                                     avl_persist_node_t *side_child, avl_persist_node_t *other_child)
+{
+	return ((LEFT == side) ? MakeNode(tree, data, side_child, other_child) :
+	                         MakeNode(tree, data, other_child, side_child));
+}
+
+/* takes a node from the spares, FillSpares must have made sure there is one */
+static avl_persist_node_t *MakeNode(avl_persist_t *tree, void *data,
+                                    avl_persist_node_t *left, avl_persist_node_t *right)
+{
+	avl_persist_node_t *node = tree->spares;
+	assert(NULL != node);
+	tree->spares = node->child[LEFT];
+	--tree->num_spares;
+	node->data = data;
+	node->refs = 1;
+	node->child[LEFT] = left;
+	node->child[RIGHT] = right;
+	node->height = MAX(GetHeight(left), GetHeight(right)) + 1;
+	node->size = GetSize(left) + GetSize(right) + 1;
+	return (node);
+}
+
+static avl_persist_node_t *IncRef(avl_persist_node_t *node)
+{
+	if(NULL != node)
+	{
+		__atomic_add_fetch(&node->refs, 1, __ATOMIC_RELAXED);
+	}
+	return (node);
+}
+
+/* drops one reference to node. when it was the last, the node is freed and
+   its children lose a reference too */
+static void Release(avl_persist_t *tree, avl_persist_node_t *node)
+{
+	avl_persist_node_t *stack[MAX_DEPTH];
+	avl_persist_node_t *next = NULL;
+	size_t depth = 0;
+	for(; NULL != node; node = next)
+	{
+		next = NULL;
+		if(0 == __atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL))
+		{
+			if(NULL != node->child[RIGHT])
+			{
+				stack[depth++] = node->child[RIGHT];
+			}
+			next = node->child[LEFT];
+			FreeNode(tree, node);
+		}
+		if(NULL == next && 0 < depth)
+		{
+			next = stack[--depth];
+		}
+	}
+}
+
+static int FillSpares(avl_persist_t *tree, size_t count)
+{
+	avl_persist_node_t *node = NULL;
+	while(tree->num_spares < count)
+	{
+		node = (avl_persist_node_t*) malloc(sizeof(avl_persist_node_t));
+		if(NULL == node)
+		{
+			return (FAIL);
+		}
+		FreeNode(tree, node);
+	}
+	return (SUCCESS);
+}
+
+/* freed nodes are kept as spares for the next changes, up to a limit */
+static void FreeNode(avl_persist_t *tree, avl_persist_node_t *node)
+{
+	if(MAX_SPARES <= tree->num_spares)
+	{
+		free(node);
+		return;
+	}
+	node->child[LEFT] = tree->spares;
+	tree->spares = node;
+	++tree->num_spares;
+}
+
+static long GetHeight(const avl_persist_node_t *node)
+{
+	return ((NULL == node) ? 0 : (long)node->height);
+}
+
+static size_t GetSize(const avl_persist_node_t *node)
+{
+	return ((NULL == node) ? 0 : node->size);
+}
@@ -3,19 +3,50 @@
 
 #include <limits.h> /* ULONG_MAX */
 #include <assert.h> /* assert */
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__ELF__)
+#define HAS_X86_DISPATCH
+#include <immintrin.h> /* AVX2, AVX-512 intrinsics */
+#endif
 
 #include "bitarray.h"
 
 #define ARR_LEN (sizeof(bitarray_t) * CHAR_BIT)
 
+/* compile time tables, so lookups need no lazy (and racy) initialization */
+#define COUNT2(n) n, n + 1, n + 1, n + 2
+#define COUNT4(n) COUNT2(n), COUNT2(n + 1), COUNT2(n + 1), COUNT2(n + 2)
+#define COUNT6(n) COUNT4(n), COUNT4(n + 1), COUNT4(n + 1), COUNT4(n + 2)
+#define MIRROR2(n) n, n + 2 * 64, n + 1 * 64, n + 3 * 64
+#define MIRROR4(n) MIRROR2(n), MIRROR2(n + 2 * 16), \
+                   MIRROR2(n + 1 * 16), MIRROR2(n + 3 * 16)
+#define MIRROR6(n) MIRROR4(n), MIRROR4(n + 2 * 4), \
+                   MIRROR4(n + 1 * 4), MIRROR4(n + 3 * 4)
+
 /*#############################DECLARATIONS####################################*/
 
-static void InitCountLUT();
-static void InitMirrorLUT();
-static unsigned char MirrorChar(unsigned char);
+typedef size_t (*count_func_t)(bitarray_t);
+typedef size_t (*bulk_count_func_t)(const bitarray_t *, size_t);
+
+static size_t CountOnBulkGeneric(const bitarray_t *, size_t);
+
+#ifdef HAS_X86_DISPATCH
+static count_func_t ResolveCountOn(void);
+static bulk_count_func_t ResolveCountOnBulk(void);
+static size_t CountOnPopcnt(bitarray_t);
+static size_t CountOnBulkPopcnt(const bitarray_t *, size_t);
+static size_t CountOnBulkAVX2(const bitarray_t *, size_t);
+static size_t CountOnBulkAVX512(const bitarray_t *, size_t);
+#endif
+
+static const unsigned char COUNT_LUT[256] =
+{
+	COUNT6(0), COUNT6(1), COUNT6(1), COUNT6(2)
+};
 
-static size_t COUNT_LUT[256] = {0};
-static size_t MIRROR_LUT[256] = {0};
+static const unsigned char MIRROR_LUT[256] =
+{
+	MIRROR6(0), MIRROR6(2), MIRROR6(1), MIRROR6(3)
+};
 
 /*##########################FUNCTION DEFINITIONS###############################*/
 
@@ -93,6 +124,20 @@ bitarray_t BitArrayRotL(bitarray_t arr, size_t num_of_rotations)
 }
 
 bitarray_t BitArrayMirror(bitarray_t arr)
+{
+#ifdef __GNUC__
+	arr = __builtin_bswap64(arr);
+	arr = ((arr & 0xF0F0F0F0F0F0F0F0) >> 4) | ((arr & 0x0F0F0F0F0F0F0F0F) << 4);
+	arr = ((arr & 0xCCCCCCCCCCCCCCCC) >> 2) | ((arr & 0x3333333333333333) << 2);
+	arr = ((arr & 0xAAAAAAAAAAAAAAAA) >> 1) | ((arr & 0x5555555555555555) << 1);
+
+	return (arr);
+#else
+	return (BitArrayMirrorNoLoop(arr));
+#endif
+}
+
+bitarray_t BitArrayMirrorLoop(bitarray_t arr)
 {
 	bitarray_t new_arr = 0;
 	bitarray_t runner = 1;
@@ -124,17 +169,40 @@ bitarray_t BitArrayMirrorLUT(bitarray_t arr)
 	bitarray_t mirrored_arr = 0;
 	int i = 0;
 
-	InitMirrorLUT();
-
 	for (; i < 8; ++i)
 	{
-		mirrored_arr += (MIRROR_LUT[(arr >> (i * 8)) & 0xFF]) << (56 - (i * 8));
+		mirrored_arr += (bitarray_t)MIRROR_LUT[(arr >> (i * 8)) & 0xFF] << (56 - (i * 8));
 	}
 
 	return (mirrored_arr);
 }
 
+/*
+ * on x86-64 the dynamic linker calls the resolvers once, at load time, and
+ * binds the symbols straight to the chosen version - no per call dispatch
+ */
+#ifdef HAS_X86_DISPATCH
+
+size_t BitArrayCountOn(bitarray_t arr) __attribute__((ifunc("ResolveCountOn")));
+
+size_t BitArrayCountOnBulk(const bitarray_t *arr, size_t num_of_words)
+                        __attribute__((ifunc("ResolveCountOnBulk")));
+
+#else
+
 size_t BitArrayCountOn(bitarray_t arr)
+{
+	return (BitArrayCountOnNoLoop(arr));
+}
+
+size_t BitArrayCountOnBulk(const bitarray_t *arr, size_t num_of_words)
+{
+	return (CountOnBulkGeneric(arr, num_of_words));
+}
+
+#endif /* HAS_X86_DISPATCH */
+
+size_t BitArrayCountOnLoop(bitarray_t arr)
 {
 	size_t counter = 0;
 
@@ -180,8 +248,6 @@ size_t BitArrayCountOnLUT(bitarray_t arr)
 	size_t counter = 0;
 	int i = 0;
 
-	InitCountLUT();
-
 	for (; i < 8; ++i)
 	{
 		counter += COUNT_LUT[(arr >> (i * 8)) & 0xFF];
@@ -211,43 +277,127 @@ char *BitArrayToString(bitarray_t arr, char *to_write_into)
 	return (to_write_into);
 }
 
-static void InitCountLUT()
+static size_t CountOnBulkGeneric(const bitarray_t *arr, size_t num_of_words)
 {
+	size_t counter = 0;
 	size_t i = 0;
 
-	if (1 == COUNT_LUT[1])
+	for (; i < num_of_words; ++i)
+	{
+		counter += BitArrayCountOnNoLoop(arr[i]);
+	}
+
+	return (counter);
+}
+
+#ifdef HAS_X86_DISPATCH
+
+/* resolvers run before constructors, so they init the cpu model themselves */
+static count_func_t ResolveCountOn(void)
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("popcnt"))
+	{
+		return (CountOnPopcnt);
+	}
+
+	return (BitArrayCountOnNoLoop);
+}
+
+static bulk_count_func_t ResolveCountOnBulk(void)
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f") &&
+	    __builtin_cpu_supports("avx512vpopcntdq"))
 	{
-		return;
+		return (CountOnBulkAVX512);
 	}
 
-	for (; i < 256; ++i)
+	if (__builtin_cpu_supports("avx2"))
 	{
-		COUNT_LUT[i] = BitArrayCountOnNoLoop((bitarray_t)i);
+		return (CountOnBulkAVX2);
 	}
+
+	if (__builtin_cpu_supports("popcnt"))
+	{
+		return (CountOnBulkPopcnt);
+	}
+
+	return (CountOnBulkGeneric);
 }
 
-static void InitMirrorLUT()
+__attribute__((target("popcnt")))
+static size_t CountOnPopcnt(bitarray_t arr)
 {
+	return ((size_t)__builtin_popcountl(arr));
+}
+
+__attribute__((target("popcnt")))
+static size_t CountOnBulkPopcnt(const bitarray_t *arr, size_t num_of_words)
+{
+	size_t counter = 0;
 	size_t i = 0;
 
-	if (1 < MIRROR_LUT[1])
+	for (; i < num_of_words; ++i)
 	{
-		return;
+		counter += (size_t)__builtin_popcountl(arr[i]);
 	}
 
-	for (; i < 256; ++i)
+	return (counter);
+}
+
+/*
+ * nibble lookup with vpshufb, summed per 64 bit lane with vpsadbw
+ * (Mula's method), four words per iteration
+ */
+__attribute__((target("avx2,popcnt")))
+static size_t CountOnBulkAVX2(const bitarray_t *arr, size_t num_of_words)
+{
+	const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+	                                        1, 2, 2, 3, 2, 3, 3, 4,
+	                                        0, 1, 1, 2, 1, 2, 2, 3,
+	                                        1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i low_mask = _mm256_set1_epi8(0x0F);
+	__m256i total = _mm256_setzero_si256();
+	__m256i chunk, low, high, counts;
+	size_t i = 0;
+
+	for (; i + 4 <= num_of_words; i += 4)
 	{
-		MIRROR_LUT[i] = MirrorChar((unsigned char)i);
+		chunk = _mm256_loadu_si256((const __m256i *)(arr + i));
+		low = _mm256_and_si256(chunk, low_mask);
+		high = _mm256_and_si256(_mm256_srli_epi16(chunk, 4), low_mask);
+		counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+		                         _mm256_shuffle_epi8(lookup, high));
+		total = _mm256_add_epi64(total,
+		                   _mm256_sad_epu8(counts, _mm256_setzero_si256()));
 	}
+
+	return ((size_t)_mm256_extract_epi64(total, 0) +
+	        (size_t)_mm256_extract_epi64(total, 1) +
+	        (size_t)_mm256_extract_epi64(total, 2) +
+	        (size_t)_mm256_extract_epi64(total, 3) +
+	        CountOnBulkPopcnt(arr + i, num_of_words - i));
 }
 
-static unsigned char MirrorChar(unsigned char ch)
+__attribute__((target("avx512f,avx512vpopcntdq,popcnt")))
+static size_t CountOnBulkAVX512(const bitarray_t *arr, size_t num_of_words)
 {
-	ch = ((ch) >> 4) | ((ch) << 4);
-	ch = ((ch & 0xCC) >> 2) | ((ch & 0x33) << 2);
-	ch = ((ch & 0xAA) >> 1) | ((ch & 0x55) << 1);
+	__m512i total = _mm512_setzero_si512();
+	size_t i = 0;
 
-	return (ch);
+	for (; i + 8 <= num_of_words; i += 8)
+	{
+		total = _mm512_add_epi64(total,
+		        _mm512_popcnt_epi64(_mm512_loadu_si512((const void *)(arr + i))));
+	}
+
+	return ((size_t)_mm512_reduce_add_epi64(total) +
+	        CountOnBulkPopcnt(arr + i, num_of_words - i));
 }
 
-/* How did you get here? */
\ No newline at end of file
+#endif /* HAS_X86_DISPATCH */
+
+/* How did you get here? */
@@ -0,0 +1,380 @@
+
+/*##########################LIBRARIES & MACROS#################################*/
+
+#include <stdlib.h> /* malloc, realloc, free */
+#include <string.h> /* memset */
+#include <limits.h> /* CHAR_BIT */
+#include <assert.h> /* assert */
+
+#include "../include/bitvector.h"
+
+#define WORD_BITS (sizeof(bitarray_t) * CHAR_BIT)
+#define WORDS_FOR(num_of_bits) (((num_of_bits) + WORD_BITS - 1) / WORD_BITS)
+#define WORD_INDEX(bit) ((bit) / WORD_BITS)
+#define BIT_INDEX(bit) ((bit) % WORD_BITS)
+#define SUCCESS 0
+#define FAIL 1
+
+/*#############################DECLARATIONS####################################*/
+
+typedef bitarray_t (*mask_op_t)(bitarray_t word, bitarray_t mask);
+
+static bitarray_t RangeMask(size_t from, size_t to);
+static void ApplyRange(bitvector_ptr_t, size_t, size_t, mask_op_t);
+static bitarray_t SetMask(bitarray_t, bitarray_t);
+static bitarray_t ClearMask(bitarray_t, bitarray_t);
+static bitarray_t FlipMask(bitarray_t, bitarray_t);
+static size_t FindFirst(const bitvector_ptr_t, size_t, bitarray_t);
+static size_t TrailingZeros(bitarray_t);
+static void ClearTail(bitvector_ptr_t);
+
+/*############################# DEFINITIONS ###############################*/
+
+struct bitvector
+{
+	bitarray_t *words;
+	size_t num_of_bits;
+	size_t num_of_words;
+};
+
+bitvector_ptr_t BitVectorCreate(size_t num_of_bits)
+{
+	bitvector_ptr_t vector = (bitvector_ptr_t)malloc(sizeof(bitvector_t));
+
+	if (NULL == vector)
+	{
+		return (NULL);
+	}
+
+	vector->num_of_words = WORDS_FOR(num_of_bits);
+	vector->num_of_bits = num_of_bits;
+	vector->words = (bitarray_t *)calloc(vector->num_of_words + 1,
+	                                     sizeof(bitarray_t));
+
+	if (NULL == vector->words)
+	{
+		free(vector);
+		return (NULL);
+	}
+
+	return (vector);
+}
+
+void BitVectorDestroy(bitvector_ptr_t vector)
+{
+	assert(NULL != vector);
+
+	free(vector->words);
+	vector->words = NULL;
+	free(vector);
+}
+
+int BitVectorResize(bitvector_ptr_t vector, size_t num_of_bits)
+{
+	size_t new_num_of_words = WORDS_FOR(num_of_bits);
+	bitarray_t *new_words = NULL;
+
+	assert(NULL != vector);
+
+	if (new_num_of_words > vector->num_of_words)
+	{
+		new_words = (bitarray_t *)realloc(vector->words,
+		                    (new_num_of_words + 1) * sizeof(bitarray_t));
+
+		if (NULL == new_words)
+		{
+			return (FAIL);
+		}
+
+		memset(new_words + vector->num_of_words + 1, 0,
+		       (new_num_of_words - vector->num_of_words) * sizeof(bitarray_t));
+		vector->words = new_words;
+		vector->num_of_words = new_num_of_words;
+	}
+	else if (num_of_bits < vector->num_of_bits)
+	{
+		memset(vector->words + new_num_of_words, 0,
+		       (vector->num_of_words - new_num_of_words) * sizeof(bitarray_t));
+		vector->num_of_words = new_num_of_words;
+	}
+
+	vector->num_of_bits = num_of_bits;
+	ClearTail(vector);
+
+	return (SUCCESS);
+}
+
+size_t BitVectorSize(const bitvector_ptr_t vector)
+{
+	assert(NULL != vector);
+
+	return (vector->num_of_bits);
+}
+
+const bitarray_t *BitVectorGetWords(const bitvector_ptr_t vector)
+{
+	assert(NULL != vector);
+
+	return (vector->words);
+}
+
+int BitVectorGetVal(const bitvector_ptr_t vector, size_t index)
+{
+	assert(NULL != vector);
+	assert(index < vector->num_of_bits);
+
+	return (BitArrayGetVal(vector->words[WORD_INDEX(index)], BIT_INDEX(index)));
+}
+
+void BitVectorSetOn(bitvector_ptr_t vector, size_t index)
+{
+	bitarray_t *word = NULL;
+
+	assert(NULL != vector);
+	assert(index < vector->num_of_bits);
+
+	word = vector->words + WORD_INDEX(index);
+	*word = BitArraySetOn(*word, BIT_INDEX(index));
+}
+
+void BitVectorSetOff(bitvector_ptr_t vector, size_t index)
+{
+	bitarray_t *word = NULL;
+
+	assert(NULL != vector);
+	assert(index < vector->num_of_bits);
+
+	word = vector->words + WORD_INDEX(index);
+	*word = BitArraySetOff(*word, BIT_INDEX(index));
+}
+
+void BitVectorFlip(bitvector_ptr_t vector, size_t index)
+{
+	bitarray_t *word = NULL;
+
+	assert(NULL != vector);
+	assert(index < vector->num_of_bits);
+
+	word = vector->words + WORD_INDEX(index);
+	*word = BitArrayFlip(*word, BIT_INDEX(index));
+}
+
+void BitVectorSetRangeOn(bitvector_ptr_t vector, size_t from, size_t to)
+{
+	ApplyRange(vector, from, to, SetMask);
+}
+
+void BitVectorSetRangeOff(bitvector_ptr_t vector, size_t from, size_t to)
+{
+	ApplyRange(vector, from, to, ClearMask);
+}
+
+void BitVectorFlipRange(bitvector_ptr_t vector, size_t from, size_t to)
+{
+	ApplyRange(vector, from, to, FlipMask);
+}
+
+size_t BitVectorCountOn(const bitvector_ptr_t vector, size_t from, size_t to)
+{
+	size_t first = WORD_INDEX(from);
+	size_t last = WORD_INDEX(to);
+	size_t counter = 0;
+
+	assert(NULL != vector);
+	assert(from <= to && to <= vector->num_of_bits);
+
+	if (first == last)
+	{
+		return (BitArrayCountOn(vector->words[first] &
+		                        RangeMask(BIT_INDEX(from), BIT_INDEX(to))));
+	}
+
+	counter = BitArrayCountOn(vector->words[first] &
+	                          RangeMask(BIT_INDEX(from), WORD_BITS));
+	counter += BitArrayCountOnBulk(vector->words + first + 1, last - first - 1);
+
+	/* words[last] exists even when to is word aligned - see BitVectorCreate */
+	return (counter + BitArrayCountOn(vector->words[last] &
+	                                  RangeMask(0, BIT_INDEX(to))));
+}
+
+size_t BitVectorFindFirstOn(const bitvector_ptr_t vector, size_t from)
+{
+	return (FindFirst(vector, from, (bitarray_t)0));
+}
+
+size_t BitVectorFindFirstOff(const bitvector_ptr_t vector, size_t from)
+{
+	return (FindFirst(vector, from, BitArraySetAll(0)));
+}
+
+void BitVectorAnd(bitvector_ptr_t dest, const bitvector_ptr_t src)
+{
+	bitarray_t *dest_words = NULL;
+	const bitarray_t *src_words = NULL;
+	size_t i = 0;
+
+	assert(NULL != dest && NULL != src);
+	assert(dest->num_of_bits == src->num_of_bits);
+
+	dest_words = dest->words;
+	src_words = src->words;
+
+	for (i = 0; i < dest->num_of_words; ++i)
+	{
+		dest_words[i] &= src_words[i];
+	}
+}
+
+void BitVectorOr(bitvector_ptr_t dest, const bitvector_ptr_t src)
+{
+	bitarray_t *dest_words = NULL;
+	const bitarray_t *src_words = NULL;
+	size_t i = 0;
+
+	assert(NULL != dest && NULL != src);
+	assert(dest->num_of_bits == src->num_of_bits);
+
+	dest_words = dest->words;
+	src_words = src->words;
+
+	for (i = 0; i < dest->num_of_words; ++i)
+	{
+		dest_words[i] |= src_words[i];
+	}
+}
+
+void BitVectorXor(bitvector_ptr_t dest, const bitvector_ptr_t src)
+{
+	bitarray_t *dest_words = NULL;
+	const bitarray_t *src_words = NULL;
+	size_t i = 0;
+
+	assert(NULL != dest && NULL != src);
+	assert(dest->num_of_bits == src->num_of_bits);
+
+	dest_words = dest->words;
+	src_words = src->words;
+
+	for (i = 0; i < dest->num_of_words; ++i)
+	{
+		dest_words[i] ^= src_words[i];
+	}
+}
+
+void BitVectorAndNot(bitvector_ptr_t dest, const bitvector_ptr_t src)
+{
+	bitarray_t *dest_words = NULL;
+	const bitarray_t *src_words = NULL;
+	size_t i = 0;
+
+	assert(NULL != dest && NULL != src);
+	assert(dest->num_of_bits == src->num_of_bits);
+
+	dest_words = dest->words;
+	src_words = src->words;
+
+	for (i = 0; i < dest->num_of_words; ++i)
+	{
+		dest_words[i] &= ~src_words[i];
+	}
+}
+
+/* bits [from, to) of a single word, 0 <= from <= to <= WORD_BITS */
+static bitarray_t RangeMask(size_t from, size_t to)
+{
+	bitarray_t high = (WORD_BITS == to) ?
+	                  BitArraySetAll(0) : (((bitarray_t)1 << to) - 1);
+
+	return (high & ~(((bitarray_t)1 << from) - 1));
+}
+
+/* whole words in the middle of the range skip the mask computation */
+static void ApplyRange(bitvector_ptr_t vector, size_t from, size_t to,
+                       mask_op_t op)
+{
+	size_t first = WORD_INDEX(from);
+	size_t last = WORD_INDEX(to);
+	bitarray_t all = BitArraySetAll(0);
+	size_t i = 0;
+
+	assert(NULL != vector);
+	assert(from <= to && to <= vector->num_of_bits);
+
+	if (first == last)
+	{
+		vector->words[first] = op(vector->words[first],
+		                          RangeMask(BIT_INDEX(from), BIT_INDEX(to)));
+		return;
+	}
+
+	vector->words[first] = op(vector->words[first],
+	                          RangeMask(BIT_INDEX(from), WORD_BITS));
+
+	for (i = first + 1; i < last; ++i)
+	{
+		vector->words[i] = op(vector->words[i], all);
+	}
+
+	vector->words[last] = op(vector->words[last], RangeMask(0, BIT_INDEX(to)));
+}
+
+static bitarray_t SetMask(bitarray_t word, bitarray_t mask)
+{
+	return (word | mask);
+}
+
+static bitarray_t ClearMask(bitarray_t word, bitarray_t mask)
+{
+	return (word & ~mask);
+}
+
+static bitarray_t FlipMask(bitarray_t word, bitarray_t mask)
+{
+	return (word ^ mask);
+}
+
+/* invert is 0 to look for an on bit, all ones to look for an off bit */
+static size_t FindFirst(const bitvector_ptr_t vector, size_t from,
+                        bitarray_t invert)
+{
+	size_t i = WORD_INDEX(from);
+	bitarray_t word = 0;
+	size_t found = 0;
+
+	assert(NULL != vector);
+
+	if (from >= vector->num_of_bits)
+	{
+		return (vector->num_of_bits);
+	}
+
+	word = (vector->words[i] ^ invert) & RangeMask(BIT_INDEX(from), WORD_BITS);
+
+	while (0 == word && ++i < vector->num_of_words)
+	{
+		word = vector->words[i] ^ invert;
+	}
+
+	if (0 == word)
+	{
+		return (vector->num_of_bits);
+	}
+
+	found = i * WORD_BITS + TrailingZeros(word);
+
+	/* off bits past the end are padding, not part of the vector */
+	return (found < vector->num_of_bits ? found : vector->num_of_bits);
+}
+
+static size_t TrailingZeros(bitarray_t word)
+{
+	return (BitArrayCountOn((word & (~word + 1)) - 1));
+}
+
+static void ClearTail(bitvector_ptr_t vector)
+{
+	size_t last = WORD_INDEX(vector->num_of_bits);
+
+	vector->words[last] &= RangeMask(0, BIT_INDEX(vector->num_of_bits));
+}
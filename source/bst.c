@@ -1,33 +1,74 @@
 /*=========================== LIBRARIES & MACROS ============================*/
 
-#include <stdlib.h> /* malloc, free */
+#define _POSIX_C_SOURCE 200112L /* posix_memalign */
+
+#include <stdlib.h> /* posix_memalign, malloc, free */
 #include <assert.h> /* assert */
 
 #include "bst.h"
 #define SUCCESS 0
+#define FAIL 1
+#define RED 0
+#define BLACK 1
+#define BLACK_BIT 1
+#define BALANCED_NODE 2
+#define ARENA_NODE 4
+#define NODE_BITS 7
+#define ARENA_PAGE 4096
+#define NODES_PER_PAGE (ARENA_PAGE / sizeof(bst_node_t) - 1)
 
 /*============================== DECLARATIONS ===============================*/
 
-static bst_node_t *CreateNode(const void*);
+static bst_node_t *CreateNode(bst_t*, const void*);
+static bst_node_t *AllocFromArena(bst_t*);
+static void FreeNode(bst_node_t*);
+static void FreeAllNodes(bst_t*);
 static bst_iter_t GoDirection(bst_t*, bst_iter_t,const void*);
+static int BuildRec(bst_t*, void*[], size_t, bst_node_t*, bst_node_t**);
+static void FixAfterInsert(bst_t*, bst_node_t*);
+static void FixAfterRemove(bst_node_t*, bst_node_t*);
+static void RotateLeft(bst_node_t*);
+static void RotateRight(bst_node_t*);
+static void ReplaceChild(bst_node_t*, bst_node_t*, bst_node_t*);
+__inline__ static bst_node_t *GetParent(const bst_node_t*);
+__inline__ static void SetParent(bst_node_t*, bst_node_t*);
+__inline__ static int GetColor(const bst_node_t*);
+__inline__ static void SetColor(bst_node_t*, int);
 __inline__ static bst_iter_t GetRootFromTree(const bst_t*);
 __inline__ static bst_iter_t NodeToIter(bst_node_t*);
 __inline__ static bst_node_t *IterToNode(bst_iter_t);
 
 /*====================== STRUCT & FUNCTION DEFINITION =======================*/
 
+/* nodes are at least 8 byte aligned, so the low bits of the parent link
+   are free to hold the color and the flags that tell remove what kind of
+   tree the node is in. a node stays at four pointers */
 struct bst_node
 {
 	void *data;
 	bst_node_t *left;
 	bst_node_t *right;
-	bst_node_t *parent;
+	size_t parent_bits;
 };
 
+/* an arena chunk is made of ARENA_PAGE aligned pages, and the first node
+   slot of every page holds this header, so an arena node finds its tree by
+   rounding its address down. only the first page links to the next chunk */
+typedef struct bst_chunk
+{
+	struct bst_chunk *next;
+	bst_t *tree;
+}bst_chunk_t;
+
 struct bst
 {
 	bst_node_t dummy;
 	cmp_func_t cmp_func;
+	size_t chunk_capacity;
+	size_t chunk_used;
+	bst_chunk_t *chunks;
+	bst_node_t *free_nodes;
+	int is_balanced;
 };
 
 /* Approved by Michal */
@@ -42,8 +83,58 @@ bst_t *BSTCreate(cmp_func_t cmp_func)
 		tree->dummy.data = NULL;
 		tree->dummy.left = NULL;
 		tree->dummy.right = NULL;
-		tree->dummy.parent = NULL;
+		/* no parent, and a black dummy stops the red-black fixups at the root */
+		tree->dummy.parent_bits = BLACK_BIT;
 		tree->cmp_func = cmp_func;
+		tree->chunk_capacity = 0;
+		tree->chunk_used = 0;
+		tree->chunks = NULL;
+		tree->free_nodes = NULL;
+		tree->is_balanced = 0;
+	}
+	
+	return (tree);
+}
+
+bst_t *BSTCreateArena(cmp_func_t cmp_func, size_t chunk_capacity)
+{
+	bst_t *tree = BSTCreate(cmp_func);
+	assert(0 < chunk_capacity);
+	
+	/* chunks are made of whole pages */
+	chunk_capacity = (chunk_capacity + NODES_PER_PAGE - 1) / NODES_PER_PAGE * NODES_PER_PAGE;
+	
+	if(NULL != tree)
+	{
+		tree->chunk_capacity = chunk_capacity;
+		tree->chunk_used = chunk_capacity;
+	}
+	
+	return (tree);
+}
+
+bst_t *BSTCreateBalanced(cmp_func_t cmp_func)
+{
+	bst_t *tree = BSTCreate(cmp_func);
+	
+	if(NULL != tree)
+	{
+		tree->is_balanced = 1;
+	}
+	
+	return (tree);
+}
+
+bst_t *BSTCreateFromSorted(cmp_func_t cmp_func, void *elements[], size_t count)
+{
+	bst_t *tree = BSTCreate(cmp_func);
+	assert(NULL != elements || 0 == count);
+	
+	/* a partly built tree is still a valid bst, so destroy can clean it */
+	if(NULL != tree && SUCCESS != BuildRec(tree, elements, count, &tree->dummy, &tree->dummy.left))
+	{
+		BSTDestroy(tree);
+		tree = NULL;
 	}
 	
 	return (tree);
@@ -51,16 +142,19 @@ bst_t *BSTCreate(cmp_func_t cmp_func)
 
 void BSTDestroy(bst_t *tree)
 {
-	bst_node_t *curr_node = NULL;
-	bst_node_t *next_node = NULL;
+	bst_chunk_t *next_chunk = NULL;
 	assert(NULL != tree);
-	curr_node = BSTBegin(tree);
 	
-	while(&tree->dummy != curr_node)
+	if(0 == tree->chunk_capacity)
 	{
-		next_node = BSTIterNext(curr_node);
-		BSTRemove(curr_node);
-		curr_node = next_node;
+		FreeAllNodes(tree);
+	}
+	
+	while(NULL != tree->chunks)
+	{
+		next_chunk = tree->chunks->next;
+		free(tree->chunks);
+		tree->chunks = next_chunk;
 	}
 	
 	free(tree);
@@ -70,8 +164,9 @@ bst_iter_t BSTInsert(bst_t *tree, const void *data)
 {
 	bst_node_t *parent = NULL;
 	bst_node_t *runner = NULL;
-	bst_node_t *new_node = CreateNode(data);
+	bst_node_t *new_node = NULL;
 	assert(NULL !=tree);
+	new_node = CreateNode(tree, data);
 	parent = &tree->dummy;
 	runner = GetRootFromTree(tree);
 	
@@ -99,7 +194,12 @@ bst_iter_t BSTInsert(bst_t *tree, const void *data)
 		parent->right = new_node;
 	}
 	
-	new_node->parent = parent;
+	SetParent(new_node, parent);
+	
+	if(tree->is_balanced)
+	{
+		FixAfterInsert(tree, new_node);
+	}
 	
 	return (new_node);
 }
@@ -107,6 +207,7 @@ bst_iter_t BSTInsert(bst_t *tree, const void *data)
 void BSTRemove(bst_iter_t where)
 {
 	bst_node_t *temp = NULL;
+	bst_node_t *parent = NULL;
 	bst_node_t *where_node = NULL;
 	where_node = IterToNode(where);
 	
@@ -119,20 +220,27 @@ void BSTRemove(bst_iter_t where)
 	
 	temp = (NULL == where_node->left) ? where_node->right : where_node->left;
 	
-	if(where_node == where_node->parent->left)
+	parent = GetParent(where_node);
+	
+	if(where_node == parent->left)
 	{
-		where_node->parent->left = temp;
+		parent->left = temp;
 	}
 	else
 	{
-		where_node->parent->right = temp;
+		parent->right = temp;
 	}
 	if(NULL != temp)
 	{
-		temp->parent = where_node->parent;
+		SetParent(temp, parent);
+	}
+	
+	if((BALANCED_NODE & where_node->parent_bits) && BLACK == GetColor(where_node))
+	{
+		FixAfterRemove(temp, parent);
 	}
 	
-	free(where_node);
+	FreeNode(where_node);
 }
 
 bst_iter_t BSTFind(bst_t *tree, const void *data)
@@ -178,12 +286,12 @@ bst_iter_t BSTIterNext(bst_iter_t where)
 		return (where_node);
 	}
     
-	while (NULL != where_node->parent->parent && where_node == where_node->parent->right)
+	while (NULL != GetParent(GetParent(where_node)) && where_node == GetParent(where_node)->right)
 	{
-		where_node = where_node->parent;
+		where_node = GetParent(where_node);
 	}
     
-	return (NodeToIter(where_node->parent));
+	return (NodeToIter(GetParent(where_node)));
 }
 
 bst_iter_t BSTIterPrev(bst_iter_t where)
@@ -201,12 +309,12 @@ bst_iter_t BSTIterPrev(bst_iter_t where)
 		return (where_node);
 	}
     
-	while (NULL != where_node->parent->parent && where_node == where_node->parent->left)
+	while (NULL != GetParent(GetParent(where_node)) && where_node == GetParent(where_node)->left)
 	{
-		where_node = where_node->parent;
+		where_node = GetParent(where_node);
 	}
     
-	return (NodeToIter(where_node->parent));
+	return (NodeToIter(GetParent(where_node)));
 }
 
 bst_iter_t BSTBegin(const bst_t *tree)
@@ -261,6 +369,307 @@ int BSTIsEqual(bst_iter_t iter_one, bst_iter_t iter_two)
 	return (IterToNode(iter_one) == IterToNode(iter_two));
 }
 
+int BSTJoin(bst_t *left, const void *pivot, bst_t *right)
+{
+	bst_node_t *pivot_node = NULL;
+	assert(NULL != left);
+	assert(NULL != right);
+	assert(0 == left->chunk_capacity && 0 == right->chunk_capacity);
+	assert(!left->is_balanced && !right->is_balanced);
+	pivot_node = CreateNode(left, pivot);
+	
+	if(NULL == pivot_node)
+	{
+		return (FAIL);
+	}
+	
+	pivot_node->left = GetRootFromTree(left);
+	pivot_node->right = GetRootFromTree(right);
+	SetParent(pivot_node, &left->dummy);
+	
+	if(NULL != pivot_node->left)
+	{
+		SetParent(pivot_node->left, pivot_node);
+	}
+	if(NULL != pivot_node->right)
+	{
+		SetParent(pivot_node->right, pivot_node);
+	}
+	
+	left->dummy.left = pivot_node;
+	right->dummy.left = NULL;
+	
+	return (SUCCESS);
+}
+
+void BSTSplit(bst_t *tree, const void *key, bst_t *right)
+{
+	bst_node_t *runner = NULL;
+	bst_node_t *smaller_parent = NULL;
+	bst_node_t *bigger_parent = NULL;
+	bst_node_t **smaller_link = NULL;
+	bst_node_t **bigger_link = NULL;
+	assert(NULL != tree);
+	assert(NULL != right);
+	assert(BSTIsEmpty(right));
+	assert(0 == tree->chunk_capacity && 0 == right->chunk_capacity);
+	assert(!tree->is_balanced && !right->is_balanced);
+	runner = GetRootFromTree(tree);
+	smaller_parent = &tree->dummy;
+	smaller_link = &tree->dummy.left;
+	bigger_parent = &right->dummy;
+	bigger_link = &right->dummy.left;
+	
+	/* every node on the search path goes to the side it belongs to, and
+	   takes the subtree on its far side with it */
+	while(NULL != runner)
+	{
+		if(0 > tree->cmp_func(BSTGetData(runner), key))
+		{
+			*smaller_link = runner;
+			SetParent(runner, smaller_parent);
+			smaller_parent = runner;
+			smaller_link = &runner->right;
+			runner = runner->right;
+		}
+		else
+		{
+			*bigger_link = runner;
+			SetParent(runner, bigger_parent);
+			bigger_parent = runner;
+			bigger_link = &runner->left;
+			runner = runner->left;
+		}
+	}
+	
+	*smaller_link = NULL;
+	*bigger_link = NULL;
+}
+
+/* the middle element is the root, so depth stays at log(count) */
+static int BuildRec(bst_t *tree, void *elements[], size_t count, bst_node_t *parent, bst_node_t **link)
+{
+	size_t middle = count / 2;
+	bst_node_t *new_node = NULL;
+	*link = NULL;
+	
+	if(0 == count)
+	{
+		return (SUCCESS);
+	}
+	
+	new_node = CreateNode(tree, elements[middle]);
+	
+	if(NULL == new_node)
+	{
+		return (FAIL);
+	}
+	
+	SetParent(new_node, parent);
+	*link = new_node;
+	
+	if(SUCCESS != BuildRec(tree, elements, middle, new_node, &new_node->left))
+	{
+		return (FAIL);
+	}
+	
+	return (BuildRec(tree, elements + middle + 1, count - middle - 1, new_node, &new_node->right));
+}
+
+/* the new node comes in red; while its parent is red too, either push the
+   red up by recoloring, or end it with one or two rotations */
+static void FixAfterInsert(bst_t *tree, bst_node_t *node)
+{
+	bst_node_t *parent = NULL;
+	bst_node_t *grand = NULL;
+	bst_node_t *uncle = NULL;
+	SetColor(node, RED);
+	
+	while(RED == GetColor(GetParent(node)))
+	{
+		parent = GetParent(node);
+		grand = GetParent(parent);
+		uncle = (parent == grand->left) ? grand->right : grand->left;
+		
+		if(RED == GetColor(uncle))
+		{
+			SetColor(parent, BLACK);
+			SetColor(uncle, BLACK);
+			SetColor(grand, RED);
+			node = grand;
+			continue;
+		}
+		
+		if(parent == grand->left)
+		{
+			if(node == parent->right)
+			{
+				RotateLeft(parent);
+				parent = node;
+			}
+			RotateRight(grand);
+		}
+		else
+		{
+			if(node == parent->left)
+			{
+				RotateRight(parent);
+				parent = node;
+			}
+			RotateLeft(grand);
+		}
+		
+		SetColor(parent, BLACK);
+		SetColor(grand, RED);
+		break;
+	}
+	
+	SetColor(tree->dummy.left, BLACK);
+}
+
+/* node took the place of a removed black node and is short one black on
+   its path. parent is passed since node may be NULL. the dummy is the only
+   node without a parent */
+static void FixAfterRemove(bst_node_t *node, bst_node_t *parent)
+{
+	bst_node_t *sibling = NULL;
+	
+	while(NULL != GetParent(parent) && BLACK == GetColor(node))
+	{
+		if(node == parent->left)
+		{
+			sibling = parent->right;
+			if(RED == GetColor(sibling))
+			{
+				SetColor(sibling, BLACK);
+				SetColor(parent, RED);
+				RotateLeft(parent);
+				sibling = parent->right;
+			}
+			if(BLACK == GetColor(sibling->left) && BLACK == GetColor(sibling->right))
+			{
+				SetColor(sibling, RED);
+				node = parent;
+				parent = GetParent(node);
+				continue;
+			}
+			if(BLACK == GetColor(sibling->right))
+			{
+				SetColor(sibling->left, BLACK);
+				SetColor(sibling, RED);
+				RotateRight(sibling);
+				sibling = parent->right;
+			}
+			SetColor(sibling->right, BLACK);
+			SetColor(sibling, GetColor(parent));
+			SetColor(parent, BLACK);
+			RotateLeft(parent);
+		}
+		else
+		{
+			sibling = parent->left;
+			if(RED == GetColor(sibling))
+			{
+				SetColor(sibling, BLACK);
+				SetColor(parent, RED);
+				RotateRight(parent);
+				sibling = parent->left;
+			}
+			if(BLACK == GetColor(sibling->left) && BLACK == GetColor(sibling->right))
+			{
+				SetColor(sibling, RED);
+				node = parent;
+				parent = GetParent(node);
+				continue;
+			}
+			if(BLACK == GetColor(sibling->left))
+			{
+				SetColor(sibling->right, BLACK);
+				SetColor(sibling, RED);
+				RotateLeft(sibling);
+				sibling = parent->left;
+			}
+			SetColor(sibling->left, BLACK);
+			SetColor(sibling, GetColor(parent));
+			SetColor(parent, BLACK);
+			RotateRight(parent);
+		}
+		return;
+	}
+	
+	if(NULL != node)
+	{
+		SetColor(node, BLACK);
+	}
+}
+
+static void RotateLeft(bst_node_t *node)
+{
+	bst_node_t *new_root = node->right;
+	node->right = new_root->left;
+	
+	if(NULL != new_root->left)
+	{
+		SetParent(new_root->left, node);
+	}
+	
+	ReplaceChild(GetParent(node), node, new_root);
+	new_root->left = node;
+	SetParent(node, new_root);
+}
+
+static void RotateRight(bst_node_t *node)
+{
+	bst_node_t *new_root = node->left;
+	node->left = new_root->right;
+	
+	if(NULL != new_root->right)
+	{
+		SetParent(new_root->right, node);
+	}
+	
+	ReplaceChild(GetParent(node), node, new_root);
+	new_root->right = node;
+	SetParent(node, new_root);
+}
+
+/* works for the root as well, it is the left child of the dummy */
+static void ReplaceChild(bst_node_t *parent, bst_node_t *old_child, bst_node_t *new_child)
+{
+	if(old_child == parent->left)
+	{
+		parent->left = new_child;
+	}
+	else
+	{
+		parent->right = new_child;
+	}
+	
+	SetParent(new_child, parent);
+}
+
+__inline__ static bst_node_t *GetParent(const bst_node_t *node)
+{
+	return ((bst_node_t*)(node->parent_bits & ~(size_t)NODE_BITS));
+}
+
+/* keeps the color and flags of node */
+__inline__ static void SetParent(bst_node_t *node, bst_node_t *parent)
+{
+	node->parent_bits = (size_t)parent | (node->parent_bits & NODE_BITS);
+}
+
+/* missing children count as black */
+__inline__ static int GetColor(const bst_node_t *node)
+{
+	return ((NULL == node || (BLACK_BIT & node->parent_bits)) ? BLACK : RED);
+}
+
+__inline__ static void SetColor(bst_node_t *node, int color)
+{
+	node->parent_bits = (node->parent_bits & ~(size_t)BLACK_BIT) | (BLACK == color ? BLACK_BIT : 0);
+}
+
 static bst_iter_t GoDirection(bst_t *tree, bst_iter_t runner,const void* data)
 {
 	if (0 > tree->cmp_func(data, BSTGetData(runner)))
@@ -280,20 +689,122 @@ __inline__ static bst_node_t *IterToNode(bst_iter_t iter)
 	return ((bst_node_t*)iter);
 }
 
-static bst_node_t *CreateNode(const void *data)
+static bst_node_t *CreateNode(bst_t *tree, const void *data)
 {
-	bst_node_t *new_node = (bst_node_t*) malloc(sizeof(bst_node_t));
+	bst_node_t *new_node = NULL;
+	
+	if(0 == tree->chunk_capacity)
+	{
+		new_node = (bst_node_t*) malloc(sizeof(bst_node_t));
+	}
+	else
+	{
+		new_node = AllocFromArena(tree);
+	}
 	
 	if(NULL != new_node)
 	{
 		new_node->data = (void*)data;
 		new_node->left = NULL;
 		new_node->right = NULL;
+		assert(0 == ((size_t)new_node & NODE_BITS));
+		new_node->parent_bits = (tree->is_balanced ? BALANCED_NODE : 0) |
+		                        (0 != tree->chunk_capacity ? ARENA_NODE : 0);
+	}
+	
+	return (new_node);
+}
+
+/* reuses a removed node if there is one, otherwise takes the next node of
+   the newest chunk, writing the page header first when the node opens a
+   new page */
+static bst_node_t *AllocFromArena(bst_t *tree)
+{
+	void *memory = NULL;
+	bst_node_t *page = NULL;
+	bst_node_t *new_node = tree->free_nodes;
+	
+	if(NULL != new_node)
+	{
+		tree->free_nodes = new_node->right;
+		return (new_node);
+	}
+	
+	if(tree->chunk_used == tree->chunk_capacity)
+	{
+		if(0 != posix_memalign(&memory, ARENA_PAGE, tree->chunk_capacity / NODES_PER_PAGE * ARENA_PAGE))
+		{
+			return (NULL);
+		}
+		
+		((bst_chunk_t*)memory)->next = tree->chunks;
+		tree->chunks = (bst_chunk_t*)memory;
+		tree->chunk_used = 0;
+	}
+	
+	page = (bst_node_t*)((char*)tree->chunks + tree->chunk_used / NODES_PER_PAGE * ARENA_PAGE);
+	
+	if(0 == tree->chunk_used % NODES_PER_PAGE)
+	{
+		((bst_chunk_t*)page)->tree = tree;
 	}
 	
+	new_node = page + 1 + tree->chunk_used % NODES_PER_PAGE;
+	++tree->chunk_used;
+	
 	return (new_node);
 }
 
+/* arena nodes go on the free list of their tree, threaded through their
+   right link. the tree is reached through the header of the node's page */
+static void FreeNode(bst_node_t *node)
+{
+	bst_t *tree = NULL;
+	
+	if(!(ARENA_NODE & node->parent_bits))
+	{
+		free(node);
+		return;
+	}
+	
+	tree = ((bst_chunk_t*)((size_t)node & ~(size_t)(ARENA_PAGE - 1)))->tree;
+	node->right = tree->free_nodes;
+	tree->free_nodes = node;
+}
+
+/* frees every node in post order, climbing back up by the parent links */
+static void FreeAllNodes(bst_t *tree)
+{
+	bst_node_t *runner = GetRootFromTree(tree);
+	bst_node_t *parent = NULL;
+	
+	while(NULL != runner)
+	{
+		if(NULL != runner->left)
+		{
+			runner = runner->left;
+		}
+		else if(NULL != runner->right)
+		{
+			runner = runner->right;
+		}
+		else
+		{
+			parent = GetParent(runner);
+			if(runner == parent->left)
+			{
+				parent->left = NULL;
+			}
+			else
+			{
+				parent->right = NULL;
+			}
+			free(runner);
+			runner = (&tree->dummy == parent) ? NULL : parent;
+		}
+	}
+}
+
 __inline__ static bst_iter_t GetRootFromTree(const bst_t *tree)
 {
 	return (tree->dummy.left);
@@ -0,0 +1,804 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#define _POSIX_C_SOURCE 200112L /* posix_memalign */
+
+#include <stdlib.h> /* posix_memalign, free */
+#include <string.h> /* memmove, memcpy */
+#include <assert.h> /* assert */
+
+#include "../include/btree.h"
+
+/* leaves come out at exactly 256 bytes, inner nodes at 480 */
+#define MAX_KEYS 29
+#define MIN_KEYS (MAX_KEYS / 2)
+#define MAX_HEIGHT 16
+#define CACHE_LINE 64
+#define SUCCESS 0
+#define FAIL 1
+
+/*============================== DECLARATIONS ===============================*/
+
+/*
+ * leaves and inner nodes share this header, so a node can be read without
+ * knowing its kind. in a leaf keys are the elements, in an inner node
+ * keys[i] separates children[i] (smaller) from children[i + 1] (not smaller)
+ */
+typedef struct btree_node
+{
+	unsigned int num_keys;
+	unsigned int is_leaf;
+	void *keys[MAX_KEYS];
+}btree_node_t;
+
+typedef struct btree_leaf
+{
+	btree_node_t header;
+	struct btree_leaf *next;
+	struct btree_leaf *prev;
+}btree_leaf_t;
+
+typedef struct btree_inner
+{
+	btree_node_t header;
+	btree_node_t *children[MAX_KEYS + 1];
+}btree_inner_t;
+
+typedef struct path_step
+{
+	btree_inner_t *node;
+	size_t child_index;
+}path_step_t;
+
+struct btree
+{
+	btree_node_t *root;
+	size_t height;
+	size_t size;
+	cmp_func_t cmp_func;
+};
+
+static void DestroyNodesRec(btree_node_t *);
+static btree_leaf_t *CreateLeaf(void);
+static btree_inner_t *CreateInner(void);
+static void *AlignedAlloc(size_t);
+static size_t UpperBound(const btree_t *, const btree_node_t *, const void *);
+static size_t LowerBound(const btree_t *, const btree_node_t *, const void *);
+static btree_leaf_t *Descend(const btree_t *, const void *, path_step_t *);
+static void InsertKeyAt(btree_node_t *, size_t, void *);
+static void RemoveKeyAt(btree_node_t *, size_t);
+static void InsertChildAt(btree_inner_t *, size_t, void *, btree_node_t *);
+static void RemoveChildAt(btree_inner_t *, size_t);
+static void SplitLeaf(btree_leaf_t *, btree_leaf_t *);
+static void *SplitInner(btree_inner_t *, btree_inner_t *);
+static size_t CountSplits(const btree_t *, const path_step_t *);
+static int AllocSpares(btree_inner_t **, size_t);
+static void FreeSpares(btree_inner_t **, size_t);
+static void InsertUp(btree_t *, path_step_t *, void *, btree_node_t *,
+                     btree_inner_t **);
+static void UpdateSeparator(const btree_t *, path_step_t *, void *);
+static void FixUnderflow(btree_t *, path_step_t *, size_t);
+static void FixLeaf(btree_inner_t *, size_t);
+static void FixInner(btree_inner_t *, size_t);
+static int ForEachFromLeaf(btree_leaf_t *, size_t, const btree_t *,
+                           const void *, action_func_t, void *);
+
+/*====================== STRUCT & FUNCTION DEFINITION =======================*/
+
+btree_t *BTreeCreate(cmp_func_t cmp_func)
+{
+	btree_t *tree = NULL;
+
+	assert(NULL != cmp_func);
+
+	tree = (btree_t *)malloc(sizeof(btree_t));
+
+	if (NULL != tree)
+	{
+		tree->root = NULL;
+		tree->height = 0;
+		tree->size = 0;
+		tree->cmp_func = cmp_func;
+	}
+
+	return (tree);
+}
+
+void BTreeDestroy(btree_t *tree)
+{
+	assert(NULL != tree);
+
+	if (NULL != tree->root)
+	{
+		DestroyNodesRec(tree->root);
+	}
+
+	free(tree);
+}
+
+int BTreeInsert(btree_t *tree, void *data)
+{
+	path_step_t path[MAX_HEIGHT];
+	btree_leaf_t *leaf = NULL;
+	btree_inner_t *spares[MAX_HEIGHT];
+	size_t spares_count = 0;
+	btree_leaf_t *right = NULL;
+	size_t pos = 0;
+
+	assert(NULL != tree);
+
+	if (NULL == tree->root)
+	{
+		leaf = CreateLeaf();
+
+		if (NULL == leaf)
+		{
+			return (FAIL);
+		}
+
+		tree->root = &leaf->header;
+		tree->height = 1;
+	}
+
+	leaf = Descend(tree, data, path);
+	pos = UpperBound(tree, &leaf->header, data);
+
+	if (0 < pos && 0 == tree->cmp_func(data, leaf->header.keys[pos - 1]))
+	{
+		return (FAIL);
+	}
+
+	if (MAX_KEYS > leaf->header.num_keys)
+	{
+		InsertKeyAt(&leaf->header, pos, data);
+		++tree->size;
+		return (SUCCESS);
+	}
+
+	spares_count = CountSplits(tree, path);
+
+	if (SUCCESS != AllocSpares(spares, spares_count))
+	{
+		return (FAIL);
+	}
+
+	right = CreateLeaf();
+
+	if (NULL == right)
+	{
+		FreeSpares(spares, spares_count);
+		return (FAIL);
+	}
+
+	SplitLeaf(leaf, right);
+
+	if (pos <= leaf->header.num_keys)
+	{
+		InsertKeyAt(&leaf->header, pos, data);
+	}
+	else
+	{
+		InsertKeyAt(&right->header, pos - leaf->header.num_keys, data);
+	}
+
+	InsertUp(tree, path, right->header.keys[0], &right->header, spares);
+	++tree->size;
+
+	return (SUCCESS);
+}
+
+void BTreeRemove(btree_t *tree, const void *key)
+{
+	path_step_t path[MAX_HEIGHT];
+	btree_leaf_t *leaf = NULL;
+	size_t pos = 0;
+
+	assert(NULL != tree);
+
+	if (NULL == tree->root)
+	{
+		return;
+	}
+
+	leaf = Descend(tree, key, path);
+	pos = LowerBound(tree, &leaf->header, key);
+
+	if (pos == leaf->header.num_keys ||
+	    0 != tree->cmp_func(key, leaf->header.keys[pos]))
+	{
+		return;
+	}
+
+	RemoveKeyAt(&leaf->header, pos);
+	--tree->size;
+
+	/* a leaf's first key may be a separator above it, which must not be
+	   left pointing at the removed element */
+	if (0 == pos && 0 < leaf->header.num_keys)
+	{
+		UpdateSeparator(tree, path, leaf->header.keys[0]);
+	}
+
+	FixUnderflow(tree, path, tree->height - 1);
+}
+
+void *BTreeFind(const btree_t *tree, const void *key)
+{
+	const btree_node_t *node = NULL;
+	size_t pos = 0;
+
+	assert(NULL != tree);
+
+	node = tree->root;
+
+	if (NULL == node)
+	{
+		return (NULL);
+	}
+
+	while (!node->is_leaf)
+	{
+		node = ((const btree_inner_t *)node)->children[UpperBound(tree, node, key)];
+	}
+
+	pos = LowerBound(tree, node, key);
+
+	if (pos < node->num_keys && 0 == tree->cmp_func(key, node->keys[pos]))
+	{
+		return (node->keys[pos]);
+	}
+
+	return (NULL);
+}
+
+size_t BTreeSize(const btree_t *tree)
+{
+	assert(NULL != tree);
+
+	return (tree->size);
+}
+
+int BTreeIsEmpty(const btree_t *tree)
+{
+	assert(NULL != tree);
+
+	return (0 == tree->size);
+}
+
+size_t BTreeHeight(const btree_t *tree)
+{
+	assert(NULL != tree);
+
+	return (tree->height);
+}
+
+int BTreeForEach(btree_t *tree, action_func_t action_func, void *param)
+{
+	btree_node_t *node = NULL;
+
+	assert(NULL != tree);
+	assert(NULL != action_func);
+
+	node = tree->root;
+
+	if (NULL == node)
+	{
+		return (SUCCESS);
+	}
+
+	while (!node->is_leaf)
+	{
+		node = ((btree_inner_t *)node)->children[0];
+	}
+
+	return (ForEachFromLeaf((btree_leaf_t *)node, 0, tree, NULL,
+	                        action_func, param));
+}
+
+int BTreeForEachRange(btree_t *tree, const void *from, const void *to,
+                      action_func_t action_func, void *param)
+{
+	path_step_t path[MAX_HEIGHT];
+	btree_leaf_t *leaf = NULL;
+
+	assert(NULL != tree);
+	assert(NULL != action_func);
+
+	if (NULL == tree->root)
+	{
+		return (SUCCESS);
+	}
+
+	leaf = Descend(tree, from, path);
+
+	return (ForEachFromLeaf(leaf, LowerBound(tree, &leaf->header, from), tree,
+	                        to, action_func, param));
+}
+
+/*============================ STATIC FUNCTIONS =============================*/
+
+static void DestroyNodesRec(btree_node_t *node)
+{
+	size_t i = 0;
+
+	if (!node->is_leaf)
+	{
+		for (i = 0; i <= node->num_keys; ++i)
+		{
+			DestroyNodesRec(((btree_inner_t *)node)->children[i]);
+		}
+	}
+
+	free(node);
+}
+
+/* to == NULL means no upper limit */
+static int ForEachFromLeaf(btree_leaf_t *leaf, size_t pos, const btree_t *tree,
+                           const void *to, action_func_t action_func, void *param)
+{
+	int status = SUCCESS;
+
+	for (; NULL != leaf; leaf = leaf->next, pos = 0)
+	{
+		for (; pos < leaf->header.num_keys; ++pos)
+		{
+			if (NULL != to && 0 <= tree->cmp_func(leaf->header.keys[pos], to))
+			{
+				return (SUCCESS);
+			}
+
+			status = action_func(leaf->header.keys[pos], param);
+
+			if (SUCCESS != status)
+			{
+				return (status);
+			}
+		}
+	}
+
+	return (SUCCESS);
+}
+
+/* records the inner nodes passed and the child taken in each of them */
+static btree_leaf_t *Descend(const btree_t *tree, const void *key,
+                             path_step_t *path)
+{
+	btree_node_t *node = tree->root;
+	size_t depth = 0;
+
+	while (!node->is_leaf)
+	{
+		path[depth].node = (btree_inner_t *)node;
+		path[depth].child_index = UpperBound(tree, node, key);
+		node = path[depth].node->children[path[depth].child_index];
+		++depth;
+	}
+
+	return ((btree_leaf_t *)node);
+}
+
+/* number of keys in node that are not bigger than key */
+static size_t UpperBound(const btree_t *tree, const btree_node_t *node,
+                         const void *key)
+{
+	size_t low = 0;
+	size_t high = node->num_keys;
+	size_t mid = 0;
+
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+
+		if (0 > tree->cmp_func(key, node->keys[mid]))
+		{
+			high = mid;
+		}
+		else
+		{
+			low = mid + 1;
+		}
+	}
+
+	return (low);
+}
+
+/* number of keys in node that are smaller than key */
+static size_t LowerBound(const btree_t *tree, const btree_node_t *node,
+                         const void *key)
+{
+	size_t low = 0;
+	size_t high = node->num_keys;
+	size_t mid = 0;
+
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+
+		if (0 < tree->cmp_func(key, node->keys[mid]))
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	return (low);
+}
+
+static void InsertKeyAt(btree_node_t *node, size_t pos, void *key)
+{
+	memmove(node->keys + pos + 1, node->keys + pos,
+	        (node->num_keys - pos) * sizeof(void *));
+	node->keys[pos] = key;
+	++node->num_keys;
+}
+
+static void RemoveKeyAt(btree_node_t *node, size_t pos)
+{
+	memmove(node->keys + pos, node->keys + pos + 1,
+	        (node->num_keys - pos - 1) * sizeof(void *));
+	--node->num_keys;
+}
+
+/* key goes to keys[pos] and child to children[pos + 1], right of the key */
+static void InsertChildAt(btree_inner_t *node, size_t pos, void *key,
+                          btree_node_t *child)
+{
+	memmove(node->children + pos + 2, node->children + pos + 1,
+	        (node->header.num_keys - pos) * sizeof(btree_node_t *));
+	node->children[pos + 1] = child;
+	InsertKeyAt(&node->header, pos, key);
+}
+
+/* removes keys[pos] and children[pos + 1] */
+static void RemoveChildAt(btree_inner_t *node, size_t pos)
+{
+	memmove(node->children + pos + 1, node->children + pos + 2,
+	        (node->header.num_keys - pos - 1) * sizeof(btree_node_t *));
+	RemoveKeyAt(&node->header, pos);
+}
+
+/* moves the upper half of a full leaf to right and links right after it */
+static void SplitLeaf(btree_leaf_t *leaf, btree_leaf_t *right)
+{
+	size_t keep = (MAX_KEYS + 1) / 2;
+
+	right->header.num_keys = MAX_KEYS - keep;
+	memcpy(right->header.keys, leaf->header.keys + keep,
+	       right->header.num_keys * sizeof(void *));
+	leaf->header.num_keys = keep;
+
+	right->next = leaf->next;
+	right->prev = leaf;
+
+	if (NULL != leaf->next)
+	{
+		leaf->next->prev = right;
+	}
+
+	leaf->next = right;
+}
+
+/* the middle key of a full inner node moves up, the upper half to right */
+static void *SplitInner(btree_inner_t *node, btree_inner_t *right)
+{
+	size_t mid = MAX_KEYS / 2;
+	void *middle = node->header.keys[mid];
+
+	right->header.num_keys = MAX_KEYS - mid - 1;
+	memcpy(right->header.keys, node->header.keys + mid + 1,
+	       right->header.num_keys * sizeof(void *));
+	memcpy(right->children, node->children + mid + 1,
+	       (right->header.num_keys + 1) * sizeof(btree_node_t *));
+	node->header.num_keys = mid;
+
+	return (middle);
+}
+
+/* number of inner nodes an insert into the full leaf at the path end needs */
+static size_t CountSplits(const btree_t *tree, const path_step_t *path)
+{
+	size_t depth = tree->height - 1;
+
+	while (0 < depth && MAX_KEYS == path[depth - 1].node->header.num_keys)
+	{
+		--depth;
+	}
+
+	/* every node on the path is full - the root splits and a new root grows */
+	return (tree->height - depth - 1 + (0 == depth));
+}
+
+static int AllocSpares(btree_inner_t **spares, size_t count)
+{
+	size_t i = 0;
+
+	for (i = 0; i < count; ++i)
+	{
+		spares[i] = CreateInner();
+
+		if (NULL == spares[i])
+		{
+			FreeSpares(spares, i);
+			return (FAIL);
+		}
+	}
+
+	return (SUCCESS);
+}
+
+static void FreeSpares(btree_inner_t **spares, size_t count)
+{
+	while (0 < count)
+	{
+		--count;
+		free(spares[count]);
+	}
+}
+
+/*
+ * hangs child right of key in the parent of the leaf, splitting full parents
+ * on the way up and growing a new root if needed. spares holds exactly the
+ * inner nodes this takes, so it cannot fail
+ */
+static void InsertUp(btree_t *tree, path_step_t *path, void *key,
+                     btree_node_t *child, btree_inner_t **spares)
+{
+	btree_inner_t *parent = NULL;
+	btree_inner_t *right = NULL;
+	void *middle = NULL;
+	size_t depth = tree->height - 1;
+	size_t pos = 0;
+
+	while (0 < depth)
+	{
+		--depth;
+		parent = path[depth].node;
+		pos = path[depth].child_index;
+
+		if (MAX_KEYS > parent->header.num_keys)
+		{
+			InsertChildAt(parent, pos, key, child);
+			return;
+		}
+
+		right = *spares++;
+		middle = SplitInner(parent, right);
+
+		if (pos <= parent->header.num_keys)
+		{
+			InsertChildAt(parent, pos, key, child);
+		}
+		else
+		{
+			InsertChildAt(right, pos - parent->header.num_keys - 1, key, child);
+		}
+
+		key = middle;
+		child = &right->header;
+	}
+
+	right = *spares;
+	right->header.num_keys = 1;
+	right->header.keys[0] = key;
+	right->children[0] = tree->root;
+	right->children[1] = child;
+	tree->root = &right->header;
+	++tree->height;
+}
+
+/* node at depth may have too few keys - borrow or merge up to the root */
+/* the separator for a leaf is in the deepest inner node on the path that
+   was not entered through its first child - the leaf is the leftmost one
+   below that child. a path of first children leads to the leftmost leaf,
+   which has no separator */
+static void UpdateSeparator(const btree_t *tree, path_step_t *path, void *key)
+{
+	size_t depth = tree->height - 1;
+
+	while (0 < depth)
+	{
+		--depth;
+		if (0 < path[depth].child_index)
+		{
+			path[depth].node->header.keys[path[depth].child_index - 1] = key;
+			return;
+		}
+	}
+}
+
+static void FixUnderflow(btree_t *tree, path_step_t *path, size_t depth)
+{
+	btree_node_t *root = tree->root;
+
+	for (; 0 < depth; --depth)
+	{
+		btree_inner_t *parent = path[depth - 1].node;
+		btree_node_t *node = parent->children[path[depth - 1].child_index];
+
+		if (MIN_KEYS <= node->num_keys)
+		{
+			return;
+		}
+
+		if (node->is_leaf)
+		{
+			FixLeaf(parent, path[depth - 1].child_index);
+		}
+		else
+		{
+			FixInner(parent, path[depth - 1].child_index);
+		}
+	}
+
+	if (!root->is_leaf && 0 == root->num_keys)
+	{
+		tree->root = ((btree_inner_t *)root)->children[0];
+		--tree->height;
+		free(root);
+	}
+	else if (root->is_leaf && 0 == root->num_keys)
+	{
+		tree->root = NULL;
+		tree->height = 0;
+		free(root);
+	}
+}
+
+static void FixLeaf(btree_inner_t *parent, size_t index)
+{
+	btree_leaf_t *node = (btree_leaf_t *)parent->children[index];
+	btree_leaf_t *left = NULL;
+	btree_leaf_t *right = NULL;
+
+	if (0 < index)
+	{
+		left = (btree_leaf_t *)parent->children[index - 1];
+
+		if (MIN_KEYS < left->header.num_keys)
+		{
+			InsertKeyAt(&node->header, 0,
+			            left->header.keys[left->header.num_keys - 1]);
+			--left->header.num_keys;
+			parent->header.keys[index - 1] = node->header.keys[0];
+			return;
+		}
+	}
+
+	if (index < parent->header.num_keys)
+	{
+		right = (btree_leaf_t *)parent->children[index + 1];
+
+		if (MIN_KEYS < right->header.num_keys)
+		{
+			node->header.keys[node->header.num_keys++] = right->header.keys[0];
+			RemoveKeyAt(&right->header, 0);
+			parent->header.keys[index] = right->header.keys[0];
+			return;
+		}
+	}
+
+	/* no sibling can spare a key - merge with one of them */
+	if (NULL == left)
+	{
+		left = node;
+		node = right;
+		++index;
+	}
+
+	memcpy(left->header.keys + left->header.num_keys, node->header.keys,
+	       node->header.num_keys * sizeof(void *));
+	left->header.num_keys += node->header.num_keys;
+	left->next = node->next;
+
+	if (NULL != node->next)
+	{
+		node->next->prev = left;
+	}
+
+	RemoveChildAt(parent, index - 1);
+	free(node);
+}
+
+static void FixInner(btree_inner_t *parent, size_t index)
+{
+	btree_inner_t *node = (btree_inner_t *)parent->children[index];
+	btree_inner_t *left = NULL;
+	btree_inner_t *right = NULL;
+	size_t count = 0;
+
+	if (0 < index)
+	{
+		left = (btree_inner_t *)parent->children[index - 1];
+		count = left->header.num_keys;
+
+		if (MIN_KEYS < count)
+		{
+			memmove(node->children + 1, node->children,
+			        (node->header.num_keys + 1) * sizeof(btree_node_t *));
+			node->children[0] = left->children[count];
+			InsertKeyAt(&node->header, 0, parent->header.keys[index - 1]);
+			parent->header.keys[index - 1] = left->header.keys[count - 1];
+			--left->header.num_keys;
+			return;
+		}
+	}
+
+	if (index < parent->header.num_keys)
+	{
+		right = (btree_inner_t *)parent->children[index + 1];
+
+		if (MIN_KEYS < right->header.num_keys)
+		{
+			count = node->header.num_keys;
+			node->header.keys[count] = parent->header.keys[index];
+			node->children[count + 1] = right->children[0];
+			++node->header.num_keys;
+			parent->header.keys[index] = right->header.keys[0];
+			memmove(right->children, right->children + 1,
+			        right->header.num_keys * sizeof(btree_node_t *));
+			RemoveKeyAt(&right->header, 0);
+			return;
+		}
+	}
+
+	if (NULL == left)
+	{
+		left = node;
+		node = right;
+		++index;
+	}
+
+	/* the separator comes down between the two halves */
+	count = left->header.num_keys;
+	left->header.keys[count] = parent->header.keys[index - 1];
+	memcpy(left->header.keys + count + 1, node->header.keys,
+	       node->header.num_keys * sizeof(void *));
+	memcpy(left->children + count + 1, node->children,
+	       (node->header.num_keys + 1) * sizeof(btree_node_t *));
+	left->header.num_keys += node->header.num_keys + 1;
+
+	RemoveChildAt(parent, index - 1);
+	free(node);
+}
+
+static btree_leaf_t *CreateLeaf(void)
+{
+	btree_leaf_t *leaf = (btree_leaf_t *)AlignedAlloc(sizeof(btree_leaf_t));
+
+	if (NULL != leaf)
+	{
+		leaf->header.num_keys = 0;
+		leaf->header.is_leaf = 1;
+		leaf->next = NULL;
+		leaf->prev = NULL;
+	}
+
+	return (leaf);
+}
+
+static btree_inner_t *CreateInner(void)
+{
+	btree_inner_t *inner = (btree_inner_t *)AlignedAlloc(sizeof(btree_inner_t));
+
+	if (NULL != inner)
+	{
+		inner->header.num_keys = 0;
+		inner->header.is_leaf = 0;
+	}
+
+	return (inner);
+}
+
+static void *AlignedAlloc(size_t size)
+{
+	void *memory = NULL;
+
+	if (0 != posix_memalign(&memory, CACHE_LINE, size))
+	{
+		return (NULL);
+	}
+
+	return (memory);
+}
@@ -1,144 +1,497 @@
 /*=========================== LIBRARIES & MACROS ============================*/
 
-#include <stdlib.h> /* malloc, free */
-#include <assert.h> /* assert */
+#define _GNU_SOURCE /* memfd_create, clock_gettime */
+
+#include <stdlib.h>   /* malloc, free */
+#include <string.h>   /* memcpy */
+#include <assert.h>   /* assert */
+#include <pthread.h>  /* pthread_mutex_t, pthread_cond_t */
+#include <time.h>     /* clock_gettime */
+#include <sys/mman.h> /* mmap, munmap, memfd_create */
+#include <unistd.h>   /* sysconf, ftruncate, close */
 
 #include "../include/circbuff.h"
 
-#define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
-#define DATA_ARRAY_START (4 * sizeof(size_t))
 #define MIN(a, b) ((a) > (b) ? (b) : (a))
-#define READ_INDEX 2
-#define WRITE_INDEX 3
-#define INCREASE 1
-#define DECREASE -1
+#define ROUND_UP(num, align) ((((num) + (align) - 1) / (align)) * (align))
+#define NSEC_IN_SEC 1000000000L
+#define NSEC_IN_MSEC 1000000L
+#define MSEC_IN_SEC 1000L
 
 /*============================= DECLARATIONS ================================*/
 
-static void ChangeElementCount(circbuff_ptr_t, int);
-static size_t GetIndex(const circbuff_ptr_t, int);
-static void IncreaseIndex(circbuff_ptr_t, int);
+static size_t ContiguousToEnd(const circbuff_ptr_t, size_t);
+static size_t AdvanceIndex(const circbuff_ptr_t, size_t, size_t);
+static void CopyIn(circbuff_ptr_t, const char *, size_t);
+static void CopyOut(const circbuff_ptr_t, char *, size_t);
+static char *MapMirror(size_t);
+static void InitFields(circbuff_ptr_t, size_t, int);
+static ssize_t WriteOverwrite(circbuff_ptr_t, const char *, size_t);
+static size_t WriteAvailable(circbuff_ptr_t, const char *, size_t);
+static ssize_t WriteBlocking(circbuff_ptr_t, const char *, size_t);
+static size_t ReadAvailable(circbuff_ptr_t, char *, size_t);
+static ssize_t ReadBlocking(circbuff_ptr_t, char *, size_t);
+static void GetDeadline(const circbuff_ptr_t, struct timespec *);
+static int WaitOn(circbuff_ptr_t, pthread_cond_t *, const struct timespec *);
+static void Lock(const circbuff_ptr_t);
+static void Unlock(const circbuff_ptr_t);
 
 /*====================== STRUCT & FUNCTION DEFINITION =======================*/
 
-/* 
- * buff[0] = element_count
- * buff[1] = capacity
- * buff[2] = read_index
- * buff[3] = write_index
+/*
+ * data points right past the struct for a regular buffer, and to the first
+ * of two adjacent views of the same pages for a mirrored one.
+ * lock and the conditions are only used under CB_BLOCK.
  */
-typedef struct circbuff
+struct circbuff
 {
-	size_t buff[4];
-}cb_t;
+	size_t element_count;
+	size_t capacity;
+	size_t read_index;
+	size_t write_index;
+	int is_mirrored;
+	cb_policy_t policy;
+	long timeout_ms;
+	pthread_mutex_t lock;
+	pthread_cond_t not_empty;
+	pthread_cond_t not_full;
+	char *data;
+};
+
+typedef struct circbuff cb_t;
 
  /* Approved by Tzach */
- 
+
 circbuff_ptr_t CircBuffCreate(size_t capacity)
 {
 	circbuff_ptr_t buffer = malloc(sizeof(cb_t) + capacity);
-	
-	buffer->buff[0] = 0;
-	buffer->buff[1] = capacity;
-	buffer->buff[2] = DATA_ARRAY_START;
-	buffer->buff[3] = DATA_ARRAY_START;
-	
+
+	if (NULL == buffer)
+	{
+		return (NULL);
+	}
+
+	buffer->data = (char *)buffer + sizeof(cb_t);
+	InitFields(buffer, capacity, 0);
+
+	return (buffer);
+}
+
+circbuff_ptr_t CircBuffCreateMirrored(size_t capacity)
+{
+	circbuff_ptr_t buffer = NULL;
+	long page_size = sysconf(_SC_PAGESIZE);
+
+	if (0 >= page_size || 0 == capacity)
+	{
+		return (NULL);
+	}
+
+	buffer = malloc(sizeof(cb_t));
+
+	if (NULL == buffer)
+	{
+		return (NULL);
+	}
+
+	capacity = ROUND_UP(capacity, (size_t)page_size);
+	buffer->data = MapMirror(capacity);
+
+	if (NULL == buffer->data)
+	{
+		free(buffer);
+		return (NULL);
+	}
+
+	InitFields(buffer, capacity, 1);
+
 	return (buffer);
 }
 
+void CircBuffSetPolicy(circbuff_ptr_t buffer, cb_policy_t policy, long timeout_ms)
+{
+	assert(NULL != buffer);
+
+	buffer->policy = policy;
+	buffer->timeout_ms = timeout_ms;
+}
+
 void CircBuffDestroy(circbuff_ptr_t buffer)
 {
 	assert(NULL != buffer);
+
+	pthread_cond_destroy(&buffer->not_full);
+	pthread_cond_destroy(&buffer->not_empty);
+	pthread_mutex_destroy(&buffer->lock);
+
+	if (buffer->is_mirrored)
+	{
+		munmap(buffer->data, 2 * buffer->capacity);
+	}
+
 	free(buffer);
 }
 
 ssize_t CircBuffWrite(circbuff_ptr_t buffer, const void *to_read_from, size_t num_of_bytes)
 {
-	char* read_char_runner = (char*) to_read_from;
-	char* write_char_runner = (char*) buffer->buff;
-	ssize_t counter = num_of_bytes;
-	
+	const char *src = (const char *)to_read_from;
+
 	assert(NULL != buffer);
 	assert(NULL != to_read_from);
-	
-	while(0 < num_of_bytes--)
+
+	switch (buffer->policy)
 	{
-		write_char_runner[GetIndex(buffer, WRITE_INDEX)] = *read_char_runner++;
-		IncreaseIndex(buffer, WRITE_INDEX);
-		ChangeElementCount(buffer, INCREASE);
+		case CB_FAIL:
+			if (num_of_bytes > CircBuffFreeSpace(buffer))
+			{
+				return (-1);
+			}
+			return ((ssize_t)WriteAvailable(buffer, src, num_of_bytes));
+
+		case CB_SHORT_WRITE:
+			return ((ssize_t)WriteAvailable(buffer, src, num_of_bytes));
+
+		case CB_BLOCK:
+			return (WriteBlocking(buffer, src, num_of_bytes));
+
+		default:
+			return (WriteOverwrite(buffer, src, num_of_bytes));
 	}
-	
-	return (counter);
 }
 
 ssize_t CircBuffRead(circbuff_ptr_t buffer, void *to_write_to, size_t num_of_bytes)
 {
-	char* write_char_runner = (char*) to_write_to;
-	char* read_char_runner = (char*) buffer->buff;
-	ssize_t counter = MIN(num_of_bytes, CircBuffSize(buffer));
-	
 	assert(NULL != buffer);
 	assert(NULL != to_write_to);
 
-	while((0 < num_of_bytes--) && !(CircBuffIsEmpty(buffer)))
+	if (CB_BLOCK == buffer->policy)
 	{
-		*write_char_runner++ = read_char_runner[GetIndex(buffer, READ_INDEX)];
-		IncreaseIndex(buffer, READ_INDEX);
-		ChangeElementCount(buffer, DECREASE);
+		return (ReadBlocking(buffer, (char *)to_write_to, num_of_bytes));
 	}
-	
-	return (counter);
+
+	return ((ssize_t)ReadAvailable(buffer, (char *)to_write_to, num_of_bytes));
+}
+
+void *CircBuffReserve(circbuff_ptr_t buffer, size_t num_of_bytes, size_t *reserved)
+{
+	char *span = NULL;
+
+	assert(NULL != buffer);
+	assert(NULL != reserved);
+
+	Lock(buffer);
+	*reserved = MIN(num_of_bytes, buffer->capacity - buffer->element_count);
+	*reserved = MIN(*reserved, ContiguousToEnd(buffer, buffer->write_index));
+	span = buffer->data + buffer->write_index;
+	Unlock(buffer);
+
+	return (span);
+}
+
+void CircBuffCommit(circbuff_ptr_t buffer, size_t num_of_bytes)
+{
+	assert(NULL != buffer);
+
+	Lock(buffer);
+	assert(num_of_bytes <= buffer->capacity - buffer->element_count);
+	buffer->write_index = AdvanceIndex(buffer, buffer->write_index, num_of_bytes);
+	buffer->element_count += num_of_bytes;
+	pthread_cond_signal(&buffer->not_empty);
+	Unlock(buffer);
+}
+
+const void *CircBuffPeek(const circbuff_ptr_t buffer, size_t *readable)
+{
+	const char *span = NULL;
+
+	assert(NULL != buffer);
+	assert(NULL != readable);
+
+	Lock(buffer);
+	*readable = MIN(buffer->element_count,
+	                ContiguousToEnd(buffer, buffer->read_index));
+	span = buffer->data + buffer->read_index;
+	Unlock(buffer);
+
+	return (span);
+}
+
+void CircBuffConsume(circbuff_ptr_t buffer, size_t num_of_bytes)
+{
+	assert(NULL != buffer);
+
+	Lock(buffer);
+	assert(num_of_bytes <= buffer->element_count);
+	buffer->read_index = AdvanceIndex(buffer, buffer->read_index, num_of_bytes);
+	buffer->element_count -= num_of_bytes;
+	pthread_cond_signal(&buffer->not_full);
+	Unlock(buffer);
 }
 
 int CircBuffIsEmpty(const circbuff_ptr_t buffer)
 {
 	assert(NULL != buffer);
-	return (0 == buffer->buff[0]);
+	return (0 == CircBuffSize(buffer));
 }
 
 size_t CircBuffSize(const circbuff_ptr_t buffer)
 {
+	size_t size = 0;
+
 	assert(NULL != buffer);
-	return (buffer->buff[0]);
+
+	Lock(buffer);
+	size = buffer->element_count;
+	Unlock(buffer);
+
+	return (size);
 }
 
 size_t CircBuffFreeSpace(const circbuff_ptr_t buffer)
 {
+	size_t free_space = 0;
+
 	assert(NULL != buffer);
-	return (buffer->buff[1] - buffer->buff[0]);
+
+	Lock(buffer);
+	free_space = buffer->capacity - buffer->element_count;
+	Unlock(buffer);
+
+	return (free_space);
 }
 
+static void InitFields(circbuff_ptr_t buffer, size_t capacity, int is_mirrored)
+{
+	buffer->element_count = 0;
+	buffer->capacity = capacity;
+	buffer->read_index = 0;
+	buffer->write_index = 0;
+	buffer->is_mirrored = is_mirrored;
+	buffer->policy = CB_OVERWRITE;
+	buffer->timeout_ms = -1;
+	pthread_mutex_init(&buffer->lock, NULL);
+	pthread_cond_init(&buffer->not_empty, NULL);
+	pthread_cond_init(&buffer->not_full, NULL);
+}
+
+static ssize_t WriteOverwrite(circbuff_ptr_t buffer, const char *src, size_t num_of_bytes)
+{
+	size_t to_copy = num_of_bytes;
+	size_t free_space = buffer->capacity - buffer->element_count;
+	size_t overflow = 0;
+
+	/* only the newest capacity bytes can survive an oversized write */
+	if (to_copy > buffer->capacity)
+	{
+		src += to_copy - buffer->capacity;
+		to_copy = buffer->capacity;
+	}
+
+	if (to_copy > free_space)
+	{
+		overflow = to_copy - free_space;
+	}
+
+	CopyIn(buffer, src, to_copy);
+	buffer->write_index = AdvanceIndex(buffer, buffer->write_index, to_copy);
+	buffer->element_count += to_copy - overflow;
+	buffer->read_index = AdvanceIndex(buffer, buffer->read_index, overflow);
+
+	return ((ssize_t)num_of_bytes);
+}
 
-static size_t GetIndex(const circbuff_ptr_t buffer, int num)
+/* caller holds the lock, if there is one */
+static size_t WriteAvailable(circbuff_ptr_t buffer, const char *src, size_t num_of_bytes)
 {
-	return (buffer->buff[num]);
+	size_t to_copy = MIN(num_of_bytes, buffer->capacity - buffer->element_count);
+
+	CopyIn(buffer, src, to_copy);
+	buffer->write_index = AdvanceIndex(buffer, buffer->write_index, to_copy);
+	buffer->element_count += to_copy;
+
+	return (to_copy);
 }
 
-static void IncreaseIndex(circbuff_ptr_t buffer, int num)
+static ssize_t WriteBlocking(circbuff_ptr_t buffer, const char *src, size_t num_of_bytes)
 {
-	++buffer->buff[num];
-	
-	if(buffer->buff[num] > (buffer->buff[1] + DATA_ARRAY_START - 1))
+	struct timespec deadline;
+	size_t written = 0;
+
+	GetDeadline(buffer, &deadline);
+	Lock(buffer);
+
+	while (written < num_of_bytes)
+	{
+		if (buffer->element_count == buffer->capacity &&
+		    0 != WaitOn(buffer, &buffer->not_full, &deadline))
 		{
-			buffer->buff[num] = DATA_ARRAY_START;
+			break;
 		}
+
+		written += WriteAvailable(buffer, src + written, num_of_bytes - written);
+		pthread_cond_signal(&buffer->not_empty);
+	}
+
+	Unlock(buffer);
+
+	return ((ssize_t)written);
+}
+
+/* caller holds the lock, if there is one */
+static size_t ReadAvailable(circbuff_ptr_t buffer, char *dest, size_t num_of_bytes)
+{
+	size_t to_copy = MIN(num_of_bytes, buffer->element_count);
+
+	CopyOut(buffer, dest, to_copy);
+	buffer->read_index = AdvanceIndex(buffer, buffer->read_index, to_copy);
+	buffer->element_count -= to_copy;
+
+	return (to_copy);
 }
 
-static void ChangeElementCount(circbuff_ptr_t buffer, int num)
+static ssize_t ReadBlocking(circbuff_ptr_t buffer, char *dest, size_t num_of_bytes)
 {
-	buffer->buff[0] += num;
-	
-	if(buffer->buff[0] > buffer->buff[1])
+	struct timespec deadline;
+	size_t read = 0;
+
+	GetDeadline(buffer, &deadline);
+	Lock(buffer);
+
+	while (0 < num_of_bytes && 0 == buffer->element_count)
+	{
+		if (0 != WaitOn(buffer, &buffer->not_empty, &deadline))
 		{
-			--buffer->buff[0];
-			buffer->buff[READ_INDEX] = buffer->buff[WRITE_INDEX];
+			break;
 		}
+	}
+
+	read = ReadAvailable(buffer, dest, num_of_bytes);
+	pthread_cond_signal(&buffer->not_full);
+	Unlock(buffer);
+
+	return ((ssize_t)read);
 }
 
+static void GetDeadline(const circbuff_ptr_t buffer, struct timespec *deadline)
+{
+	if (0 > buffer->timeout_ms)
+	{
+		return;
+	}
 
+	clock_gettime(CLOCK_REALTIME, deadline);
+	deadline->tv_sec += buffer->timeout_ms / MSEC_IN_SEC;
+	deadline->tv_nsec += (buffer->timeout_ms % MSEC_IN_SEC) * NSEC_IN_MSEC;
 
+	if (NSEC_IN_SEC <= deadline->tv_nsec)
+	{
+		++deadline->tv_sec;
+		deadline->tv_nsec -= NSEC_IN_SEC;
+	}
+}
 
+/* returns 0 when woken, non-zero once the deadline has passed */
+static int WaitOn(circbuff_ptr_t buffer, pthread_cond_t *cond,
+                  const struct timespec *deadline)
+{
+	if (0 > buffer->timeout_ms)
+	{
+		return (pthread_cond_wait(cond, &buffer->lock));
+	}
 
+	return (pthread_cond_timedwait(cond, &buffer->lock, deadline));
+}
 
+static void Lock(const circbuff_ptr_t buffer)
+{
+	if (CB_BLOCK == buffer->policy)
+	{
+		pthread_mutex_lock(&buffer->lock);
+	}
+}
 
+static void Unlock(const circbuff_ptr_t buffer)
+{
+	if (CB_BLOCK == buffer->policy)
+	{
+		pthread_mutex_unlock(&buffer->lock);
+	}
+}
+
+/* the mirror view makes every span up to capacity contiguous */
+static size_t ContiguousToEnd(const circbuff_ptr_t buffer, size_t index)
+{
+	return (buffer->is_mirrored ? buffer->capacity : buffer->capacity - index);
+}
+
+static size_t AdvanceIndex(const circbuff_ptr_t buffer, size_t index, size_t step)
+{
+	index += step;
+
+	if (index >= buffer->capacity)
+	{
+		index -= buffer->capacity;
+	}
+
+	return (index);
+}
+
+static void CopyIn(circbuff_ptr_t buffer, const char *src, size_t num_of_bytes)
+{
+	size_t first = MIN(num_of_bytes, ContiguousToEnd(buffer, buffer->write_index));
 
+	memcpy(buffer->data + buffer->write_index, src, first);
+	memcpy(buffer->data, src + first, num_of_bytes - first);
+}
+
+static void CopyOut(const circbuff_ptr_t buffer, char *dest, size_t num_of_bytes)
+{
+	size_t first = MIN(num_of_bytes, ContiguousToEnd(buffer, buffer->read_index));
+
+	memcpy(dest, buffer->data + buffer->read_index, first);
+	memcpy(dest + first, buffer->data, num_of_bytes - first);
+}
+
+/*
+ * reserves 2 * capacity of address space and maps the same memfd pages
+ * into both halves, so data + i and data + capacity + i alias
+ */
+static char *MapMirror(size_t capacity)
+{
+	char *base = NULL;
+	int fd = memfd_create("circbuff", MFD_CLOEXEC);
+
+	if (-1 == fd)
+	{
+		return (NULL);
+	}
+
+	if (0 != ftruncate(fd, (off_t)capacity))
+	{
+		close(fd);
+		return (NULL);
+	}
+
+	base = mmap(NULL, 2 * capacity, PROT_NONE,
+	            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (MAP_FAILED == base)
+	{
+		close(fd);
+		return (NULL);
+	}
+
+	if (MAP_FAILED == mmap(base, capacity, PROT_READ | PROT_WRITE,
+	                       MAP_SHARED | MAP_FIXED, fd, 0) ||
+	    MAP_FAILED == mmap(base + capacity, capacity, PROT_READ | PROT_WRITE,
+	                       MAP_SHARED | MAP_FIXED, fd, 0))
+	{
+		munmap(base, 2 * capacity);
+		close(fd);
+		return (NULL);
+	}
+
+	close(fd);
+
+	return (base);
+}
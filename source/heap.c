@@ -1,204 +1,699 @@
 /*=========================== LIBRARIES & MACROS ============================*/
 
-#include <stdlib.h> /* malloc, free */
+#define _POSIX_C_SOURCE 200112L /* posix_memalign */
+
+#include <stdlib.h> /* posix_memalign, malloc, free */
+#include <string.h> /* memcpy */
+#include <limits.h> /* UINT_MAX */
 #include <assert.h> /* assert */
 
 #include "vector.h"
 #include "heap.h"
 
-#define LEFT 1
-#define RIGHT 2
+#define BINARY 2
 #define INIT_CAP 10
 #define GROWTH_FACTOR 2
-#define POINTER_SIZE 8
+#define CACHE_LINE 64
 #define SUCCESS 0
 #define FAIL 1
 #define TRUE 1
 #define FALSE 0
+/* ends the list of free slots, and marks elements without a handle */
+#define NO_SLOT UINT_MAX
+/* a seq this far behind another, or more, is taken to have wrapped */
+#define SEQ_HALF (UINT_MAX / 2 + 1)
 
 /*====================== STRUCT & FUNCTION DECLATARIONS =======================*/
 
+/* kept for each element of a tracked heap, in meta at the element's index.
+   slot is the element's handle - it keeps it while it moves in the heap.
+   elements pushed without a handle have NO_SLOT. seq counts the pushes,
+   and breaks ties in a stable heap */
+typedef struct heap_meta
+{
+    unsigned int slot;
+    unsigned int seq;
+} heap_meta_t;
+
+/* array holds the bare element pointers, so heaps that never give a
+   handle and are not stable sift 8 bytes per element. it points arity - 1
+   entries into a cache line aligned block, so the children of node i,
+   array[arity * i + 1] on, start at block[arity * (i + 1)] - an 8-ary
+   node's children fill one cache line, a 4-ary node's half of one.
+   meta and slots are NULL until the heap is tracked: from creation when
+   stable, otherwise from the first BinHeapPushHandle.
+   slots[handle] holds the index of the handle's element in array. a free
+   slot holds the next free one instead */
 struct binary_heap
 {
-    vector_t *vector;
+    void **block;
+    void **array;
+    size_t size;
+    size_t capacity;
+    vector_t *meta;
+    vector_t *slots;
+    size_t free_slot;
+    size_t arity;
+    int is_min;
+    int is_stable;
+    unsigned int next_seq;
     cmp_func_t cmp;
 };
 
-static size_t GetParentIndex(size_t);
-static size_t GetLastIndex(vector_t *);
-static size_t GetChildIndex(size_t, int);
-static void *GetElement(bin_heap_t *, size_t);
-static void HeapifyUpRec(bin_heap_t *, size_t);
-static void SwapElements(vector_t *, int, int);
-static void HeapifyDownRec(bin_heap_t *, size_t);
-static int ReturnTrue(const void *, const void *);
-static void SwapWithLastElement(vector_t *, size_t);
-static int UseCompareFunc(bin_heap_t *, size_t, size_t);
-static int UseIsMatchFunc(bin_heap_t *, heap_is_match_t, size_t, void *);
+static bin_heap_t *Create(cmp_func_t, size_t, int);
+static int Grow(bin_heap_t *, size_t);
+static void **AllocBlock(size_t, size_t);
+static int Track(bin_heap_t *);
+static int Push(bin_heap_t *, const void *, unsigned int);
+static int Compare(bin_heap_t *, const void *, const void *);
+static int CompareTracked(bin_heap_t *, const void *, const heap_meta_t *,
+                          const void *, const heap_meta_t *);
+static int CompareStable(bin_heap_t *, const void *, const heap_meta_t *,
+                         const void *, const heap_meta_t *);
+static size_t GetParentIndex(bin_heap_t *, size_t);
+static size_t GetLastIndex(bin_heap_t *);
+static size_t GetFirstChildIndex(bin_heap_t *, size_t);
+static void **GetArray(bin_heap_t *);
+static heap_meta_t *GetMeta(bin_heap_t *);
+static size_t *GetSlots(bin_heap_t *);
+static int TakeSlot(bin_heap_t *, unsigned int *);
+static void FreeSlot(bin_heap_t *, size_t);
+static void SetSlot(size_t *, size_t, size_t);
+static void *RemoveAt(bin_heap_t *, size_t);
+static void SiftUp(bin_heap_t *, size_t);
+static void SiftDown(bin_heap_t *, size_t);
+static void SiftUpPlain(bin_heap_t *, size_t);
+static void SiftDownPlain(bin_heap_t *, size_t);
+static void SiftUpTracked(bin_heap_t *, size_t);
+static void SiftDownTracked(bin_heap_t *, size_t);
+static void Heapify(bin_heap_t *);
 
 /*=========================== FUNCTION DEFINITION ===========================*/
 
 bin_heap_t *BinHeapCreate(cmp_func_t cmp_func)
 {
-    bin_heap_t *heap = NULL;
-    assert(NULL != cmp_func);
-    heap = (bin_heap_t *)malloc(sizeof(bin_heap_t));
+    return (Create(cmp_func, BINARY, FALSE));
+}
+
+bin_heap_t *BinHeapCreateDary(cmp_func_t cmp_func, size_t arity)
+{
+    return (Create(cmp_func, arity, FALSE));
+}
+
+bin_heap_t *BinHeapCreateMin(cmp_func_t cmp_func)
+{
+    return (Create(cmp_func, BINARY, TRUE));
+}
+
+bin_heap_t *BinHeapCreateStable(cmp_func_t cmp_func)
+{
+    bin_heap_t *heap = Create(cmp_func, BINARY, FALSE);
     if (NULL != heap)
     {
-        heap->vector = VectorCreate(INIT_CAP, POINTER_SIZE);
-        if (NULL == heap->vector)
+        heap->is_stable = TRUE;
+        if (SUCCESS != Track(heap))
         {
-            free(heap);
-            return (NULL);
+            BinHeapDestroy(heap);
+            heap = NULL;
         }
-        heap->cmp = cmp_func;
     }
     return (heap);
 }
 
+/* meta's VectorPushBack grows when one short of full, hence the one extra */
+int BinHeapReserve(bin_heap_t *heap, size_t capacity)
+{
+    assert(NULL != heap);
+    if (capacity <= heap->capacity)
+    {
+        return (SUCCESS);
+    }
+    if (NULL != heap->meta && SUCCESS != VectorReserve(heap->meta, capacity + 1))
+    {
+        return (FAIL);
+    }
+    return (Grow(heap, capacity));
+}
+
 void BinHeapDestroy(bin_heap_t *heap)
 {
     assert(NULL != heap);
-    VectorDestroy(heap->vector);
+    free(heap->block);
+    if (NULL != heap->meta)
+    {
+        VectorDestroy(heap->meta);
+        VectorDestroy(heap->slots);
+    }
     free(heap);
 }
 
 int BinHeapPush(bin_heap_t *heap, const void *data)
 {
     assert(NULL != heap);
-    if (SUCCESS == VectorPushBack(heap->vector, &data))
+    return (Push(heap, data, NO_SLOT));
+}
+
+int BinHeapPushHandle(bin_heap_t *heap, const void *data, bin_heap_handle_t *handle)
+{
+    unsigned int slot = NO_SLOT;
+    assert(NULL != heap);
+    assert(NULL != handle);
+    if (SUCCESS != Track(heap) || SUCCESS != TakeSlot(heap, &slot))
     {
-        HeapifyUpRec(heap, GetLastIndex(heap->vector));
-        return (SUCCESS);
+        return (FAIL);
+    }
+    if (SUCCESS != Push(heap, data, slot))
+    {
+        FreeSlot(heap, slot);
+        return (FAIL);
     }
-    return (FAIL);
+    *handle = slot;
+    return (SUCCESS);
 }
 
-void BinHeapPop(bin_heap_t *heap)
+int BinHeapPushAll(bin_heap_t *heap, void *elements[], size_t count)
 {
+    heap_meta_t meta;
+    size_t old_size = 0, i = 0;
     assert(NULL != heap);
-    BinHeapRemove(heap, ReturnTrue, 0);
+    assert(NULL != elements || 0 == count);
+    old_size = heap->size;
+    if (SUCCESS != BinHeapReserve(heap, old_size + count))
+    {
+        return (FAIL);
+    }
+    meta.slot = NO_SLOT;
+    for (i = 0; i < count; ++i)
+    {
+        heap->array[heap->size++] = elements[i];
+        if (NULL != heap->meta)
+        {
+            meta.seq = heap->next_seq++;
+            VectorPushBack(heap->meta, &meta);
+        }
+    }
+    /* few new elements just go up one by one, many are cheaper to heapify
+       all together */
+    if (count < old_size)
+    {
+        for (i = old_size; i < old_size + count; ++i)
+        {
+            SiftUp(heap, i);
+        }
+    }
+    else if (0 < count)
+    {
+        Heapify(heap);
+    }
+    return (SUCCESS);
 }
 
-void *BinHeapPeek(bin_heap_t *heap)
+bin_heap_t *BinHeapCreateFromArray(cmp_func_t cmp_func, void *elements[], size_t count)
+{
+    bin_heap_t *heap = BinHeapCreate(cmp_func);
+    if (NULL != heap && SUCCESS != BinHeapPushAll(heap, elements, count))
+    {
+        BinHeapDestroy(heap);
+        heap = NULL;
+    }
+    return (heap);
+}
+
+void BinHeapPop(bin_heap_t *heap)
 {
     assert(NULL != heap);
-    assert(0 < VectorGetSize(heap->vector));
-    return (GetElement(heap, 0));
+    assert(0 < heap->size);
+    RemoveAt(heap, 0);
 }
 
-void *BinHeapRemove(bin_heap_t *heap, heap_is_match_t is_match, void *param)
+/* the new element takes the root's place and sifts down - half the work
+   of a pop followed by a push */
+void *BinHeapReplaceTop(bin_heap_t *heap, const void *data)
 {
-    size_t to_remove = 0, last_index = 0;
+    void **array = NULL;
+    heap_meta_t *meta = NULL;
     void *rtn = NULL;
     assert(NULL != heap);
-    assert(NULL != is_match);
-    last_index = GetLastIndex(heap->vector);
-    for (; to_remove <= last_index && TRUE != UseIsMatchFunc(heap, is_match, to_remove, param); ++to_remove)
-        ;
-    if (to_remove <= last_index)
+    assert(0 < heap->size);
+    array = GetArray(heap);
+    rtn = array[0];
+    array[0] = (void *)data;
+    if (NULL != heap->meta)
     {
-        rtn = GetElement(heap, to_remove);
-        SwapWithLastElement(heap->vector, to_remove);
-        VectorPopBack(heap->vector);
-        if (to_remove < last_index)
+        meta = GetMeta(heap);
+        if (NO_SLOT != meta[0].slot)
         {
-            HeapifyUpRec(heap, to_remove);
-            HeapifyDownRec(heap, to_remove);
+            FreeSlot(heap, meta[0].slot);
         }
+        meta[0].slot = NO_SLOT;
+        meta[0].seq = heap->next_seq++;
     }
+    SiftDown(heap, 0);
     return (rtn);
 }
 
+void *BinHeapPeek(bin_heap_t *heap)
+{
+    assert(NULL != heap);
+    assert(0 < heap->size);
+    return (GetArray(heap)[0]);
+}
+
+void *BinHeapRemove(bin_heap_t *heap, heap_is_match_t is_match, void *param)
+{
+    size_t to_remove = 0, size = 0;
+    void **array = NULL;
+    assert(NULL != heap);
+    assert(NULL != is_match);
+    size = heap->size;
+    if (0 == size)
+    {
+        return (NULL);
+    }
+    array = GetArray(heap);
+    for (; to_remove < size && TRUE != is_match(array[to_remove], param); ++to_remove)
+        ;
+    return ((to_remove < size) ? RemoveAt(heap, to_remove) : NULL);
+}
+
+void *BinHeapRemoveHandle(bin_heap_t *heap, bin_heap_handle_t handle)
+{
+    assert(NULL != heap);
+    assert(NULL != heap->slots && handle < VectorGetSize(heap->slots));
+    return (RemoveAt(heap, GetSlots(heap)[handle]));
+}
+
+void BinHeapUpdate(bin_heap_t *heap, bin_heap_handle_t handle)
+{
+    size_t *slots = NULL;
+    assert(NULL != heap);
+    assert(NULL != heap->slots && handle < VectorGetSize(heap->slots));
+    slots = GetSlots(heap);
+    SiftUp(heap, slots[handle]);
+    SiftDown(heap, slots[handle]);
+}
+
+void *BinHeapGetData(bin_heap_t *heap, bin_heap_handle_t handle)
+{
+    assert(NULL != heap);
+    assert(NULL != heap->slots && handle < VectorGetSize(heap->slots));
+    return (GetArray(heap)[GetSlots(heap)[handle]]);
+}
+
 size_t BinHeapSize(const bin_heap_t *heap)
 {
     assert(NULL != heap);
-    return (VectorGetSize(heap->vector));
+    return (heap->size);
 }
 
 int BinHeapIsEmpty(const bin_heap_t *heap)
 {
     assert(NULL != heap);
-    return (VectorIsEmpty(heap->vector));
+    return (0 == heap->size);
 }
 
-static size_t GetChildIndex(size_t index, int side)
+static bin_heap_t *Create(cmp_func_t cmp_func, size_t arity, int is_min)
 {
-    return ((2 * index) + side);
+    bin_heap_t *heap = NULL;
+    assert(NULL != cmp_func);
+    assert(2 <= arity);
+    heap = (bin_heap_t *)malloc(sizeof(bin_heap_t));
+    if (NULL != heap)
+    {
+        heap->block = AllocBlock(INIT_CAP, arity);
+        if (NULL == heap->block)
+        {
+            free(heap);
+            return (NULL);
+        }
+        heap->array = heap->block + arity - 1;
+        heap->size = 0;
+        heap->capacity = INIT_CAP;
+        heap->meta = NULL;
+        heap->slots = NULL;
+        heap->free_slot = NO_SLOT;
+        heap->arity = arity;
+        heap->is_min = is_min;
+        heap->is_stable = FALSE;
+        heap->next_seq = 0;
+        heap->cmp = cmp_func;
+    }
+    return (heap);
 }
 
-static size_t GetParentIndex(size_t index)
+/* a min heap is a max heap with the compare turned around.
+   keep the tie break out of line and each variant a call of its own - a
+   test after the call made gcc pick children with cmov, which stalls
+   every level on the loads of the one before and halved pop speed */
+static int Compare(bin_heap_t *heap, const void *data1, const void *data2)
 {
-    return ((0 == index) ? (index) : ((index - 1) / 2));
+    return (heap->is_min ? heap->cmp(data2, data1) : heap->cmp(data1, data2));
 }
 
-static size_t GetLastIndex(vector_t *vector)
+static int CompareTracked(bin_heap_t *heap, const void *data1, const heap_meta_t *meta1,
+                          const void *data2, const heap_meta_t *meta2)
 {
-    return ((0 == VectorGetSize(vector)) ? 0 : VectorGetSize(vector) - 1);
+    return (heap->is_stable ? CompareStable(heap, data1, meta1, data2, meta2) :
+            Compare(heap, data1, data2));
 }
 
-static void SwapElements(vector_t *vector, int first, int second)
+/* of two equal elements the one pushed first is the bigger. seq is
+   compared modulo 2^32, so that holds for pushes less than 2^31 apart */
+static int CompareStable(bin_heap_t *heap, const void *data1, const heap_meta_t *meta1,
+                         const void *data2, const heap_meta_t *meta2)
 {
-    void **ptr1 = (void **)VectorAccessAt(vector, first);
-    void **ptr2 = (void **)VectorAccessAt(vector, second);
-    void *tmp = *ptr1;
-    *ptr1 = *ptr2;
-    *ptr2 = tmp;
+    int rtn = heap->cmp(data1, data2);
+    if (0 == rtn && meta1->seq != meta2->seq)
+    {
+        rtn = ((unsigned int)(meta2->seq - meta1->seq) < SEQ_HALF) ? 1 : -1;
+    }
+    return (rtn);
 }
 
-static void SwapWithLastElement(vector_t *vector, size_t index)
+/* the children of a node sit next to each other */
+static size_t GetFirstChildIndex(bin_heap_t *heap, size_t index)
 {
-    SwapElements(vector, index, GetLastIndex(vector));
+    return ((heap->arity * index) + 1);
 }
 
-static void HeapifyUpRec(bin_heap_t *heap, size_t index)
+static size_t GetParentIndex(bin_heap_t *heap, size_t index)
 {
-    if (0 < UseCompareFunc(heap, index, GetParentIndex(index)))
+    return ((0 == index) ? (index) : ((index - 1) / heap->arity));
+}
+
+static size_t GetLastIndex(bin_heap_t *heap)
+{
+    return ((0 == heap->size) ? 0 : heap->size - 1);
+}
+
+/* the last element fills the hole, then moves whichever way it has to */
+static void *RemoveAt(bin_heap_t *heap, size_t index)
+{
+    void **array = GetArray(heap);
+    heap_meta_t *meta = NULL;
+    size_t last_index = GetLastIndex(heap);
+    void *rtn = array[index];
+    array[index] = array[last_index];
+    --heap->size;
+    if (NULL != heap->meta)
+    {
+        meta = GetMeta(heap);
+        if (NO_SLOT != meta[index].slot)
+        {
+            FreeSlot(heap, meta[index].slot);
+        }
+        meta[index] = meta[last_index];
+        VectorPopBack(heap->meta);
+    }
+    if (index < last_index)
+    {
+        SiftUp(heap, index);
+        SiftDown(heap, index);
+    }
+    return (rtn);
+}
+
+static void SiftUp(bin_heap_t *heap, size_t index)
+{
+    if (NULL == heap->meta)
+    {
+        SiftUpPlain(heap, index);
+    }
+    else
+    {
+        SiftUpTracked(heap, index);
+    }
+}
+
+static void SiftDown(bin_heap_t *heap, size_t index)
+{
+    if (NULL == heap->meta)
+    {
+        SiftDownPlain(heap, index);
+    }
+    else
+    {
+        SiftDownTracked(heap, index);
+    }
+}
+
+/* the moving element is held aside while the parents smaller than it
+   move down into the hole, and is written once where the hole stops */
+static void SiftUpPlain(bin_heap_t *heap, size_t index)
+{
+    void **array = GetArray(heap);
+    void *moving = array[index];
+    size_t parent = 0;
+    while (0 < index)
+    {
+        parent = GetParentIndex(heap, index);
+        if (0 >= Compare(heap, moving, array[parent]))
+        {
+            break;
+        }
+        array[index] = array[parent];
+        index = parent;
+    }
+    array[index] = moving;
+}
+
+/* same as SiftUpPlain, with the biggest child moving up into the hole */
+static void SiftDownPlain(bin_heap_t *heap, size_t index)
+{
+    void **array = GetArray(heap);
+    void *moving = array[index];
+    size_t size = heap->size;
+    size_t child = 0, runner = 0, end = 0;
+    while ((child = GetFirstChildIndex(heap, index)) < size)
+    {
+        end = (size - child > heap->arity) ? child + heap->arity : size;
+        for (runner = child + 1; runner < end; ++runner)
+        {
+            if (0 < Compare(heap, array[runner], array[child]))
+            {
+                child = runner;
+            }
+        }
+        if (0 >= Compare(heap, array[child], moving))
+        {
+            break;
+        }
+        array[index] = array[child];
+        index = child;
+    }
+    array[index] = moving;
+}
+
+/* as the plain loops, with meta moving alongside. every tracked element
+   that moves has its slot updated */
+static void SiftUpTracked(bin_heap_t *heap, size_t index)
+{
+    void **array = GetArray(heap);
+    heap_meta_t *meta = GetMeta(heap);
+    size_t *slots = GetSlots(heap);
+    void *moving = array[index];
+    heap_meta_t moving_meta = meta[index];
+    size_t parent = 0;
+    while (0 < index)
+    {
+        parent = GetParentIndex(heap, index);
+        if (0 >= CompareTracked(heap, moving, &moving_meta, array[parent], &meta[parent]))
+        {
+            break;
+        }
+        array[index] = array[parent];
+        meta[index] = meta[parent];
+        SetSlot(slots, meta[index].slot, index);
+        index = parent;
+    }
+    array[index] = moving;
+    meta[index] = moving_meta;
+    SetSlot(slots, moving_meta.slot, index);
+}
+
+static void SiftDownTracked(bin_heap_t *heap, size_t index)
+{
+    void **array = GetArray(heap);
+    heap_meta_t *meta = GetMeta(heap);
+    size_t *slots = GetSlots(heap);
+    void *moving = array[index];
+    heap_meta_t moving_meta = meta[index];
+    size_t size = heap->size;
+    size_t child = 0, runner = 0, end = 0;
+    while ((child = GetFirstChildIndex(heap, index)) < size)
     {
-        SwapElements(heap->vector, index, GetParentIndex(index));
-        HeapifyUpRec(heap, GetParentIndex(index));
+        end = (size - child > heap->arity) ? child + heap->arity : size;
+        for (runner = child + 1; runner < end; ++runner)
+        {
+            if (0 < CompareTracked(heap, array[runner], &meta[runner],
+                                   array[child], &meta[child]))
+            {
+                child = runner;
+            }
+        }
+        if (0 >= CompareTracked(heap, array[child], &meta[child], moving, &moving_meta))
+        {
+            break;
+        }
+        array[index] = array[child];
+        meta[index] = meta[child];
+        SetSlot(slots, meta[index].slot, index);
+        index = child;
     }
+    array[index] = moving;
+    meta[index] = moving_meta;
+    SetSlot(slots, moving_meta.slot, index);
 }
 
-static void HeapifyDownRec(bin_heap_t *heap, size_t index)
+/* Floyd's method - sifts down every parent, the last one first. most
+   nodes are near the bottom and move little, so it takes O(n) */
+static void Heapify(bin_heap_t *heap)
 {
-    size_t last_index = GetLastIndex(heap->vector);
-    size_t l_child_index = GetChildIndex(index, LEFT);
-    size_t r_child_index = GetChildIndex(index, RIGHT);
-    size_t biggest_index = index;
-    if (l_child_index <= last_index && (0 < UseCompareFunc(heap, l_child_index, biggest_index)))
+    size_t index = GetParentIndex(heap, GetLastIndex(heap)) + 1;
+    while (0 < index)
     {
-        biggest_index = l_child_index;
+        SiftDown(heap, --index);
     }
-    if (r_child_index <= last_index && (0 < UseCompareFunc(heap, r_child_index, biggest_index)))
+}
+
+/* gives every element a meta entry, the first time the heap needs them */
+static int Track(bin_heap_t *heap)
+{
+    heap_meta_t meta;
+    size_t size = 0, i = 0;
+    if (NULL != heap->meta)
     {
-        biggest_index = r_child_index;
+        return (SUCCESS);
+    }
+    size = heap->size;
+    heap->meta = VectorCreate(size + INIT_CAP, sizeof(heap_meta_t));
+    heap->slots = VectorCreate(INIT_CAP, sizeof(size_t));
+    meta.slot = NO_SLOT;
+    for (i = 0; NULL != heap->meta && NULL != heap->slots && i < size; ++i)
+    {
+        meta.seq = heap->next_seq++;
+        if (SUCCESS != VectorPushBack(heap->meta, &meta))
+        {
+            break;
+        }
     }
-    if (biggest_index != index)
+    if (NULL == heap->meta || NULL == heap->slots || i < size)
     {
-        SwapElements(heap->vector, index, biggest_index);
-        HeapifyDownRec(heap, biggest_index);
+        if (NULL != heap->meta)
+        {
+            VectorDestroy(heap->meta);
+        }
+        if (NULL != heap->slots)
+        {
+            VectorDestroy(heap->slots);
+        }
+        heap->meta = NULL;
+        heap->slots = NULL;
+        return (FAIL);
     }
+    return (SUCCESS);
 }
 
-static int UseCompareFunc(bin_heap_t *heap, size_t index1, size_t index2)
+/* room for the element is made first, so nothing is left to undo once
+   meta took its entry */
+static int Push(bin_heap_t *heap, const void *data, unsigned int slot)
 {
-    return (heap->cmp(GetElement(heap, index1), GetElement(heap, index2)));
+    heap_meta_t meta;
+    if (heap->size == heap->capacity && SUCCESS != Grow(heap, heap->size + 1))
+    {
+        return (FAIL);
+    }
+    if (NULL != heap->meta)
+    {
+        meta.slot = slot;
+        meta.seq = heap->next_seq++;
+        if (SUCCESS != VectorPushBack(heap->meta, &meta))
+        {
+            return (FAIL);
+        }
+    }
+    heap->array[heap->size++] = (void *)data;
+    SiftUp(heap, GetLastIndex(heap));
+    return (SUCCESS);
 }
 
-static int UseIsMatchFunc(bin_heap_t *heap, heap_is_match_t is_match, size_t index, void *data)
+/* aligned blocks cannot be realloc'ed, so growing copies to a new one */
+static int Grow(bin_heap_t *heap, size_t capacity)
 {
-    return (is_match(GetElement(heap, index), data));
+    void **block = NULL;
+    if (capacity < heap->capacity * GROWTH_FACTOR)
+    {
+        capacity = heap->capacity * GROWTH_FACTOR;
+    }
+    block = AllocBlock(capacity, heap->arity);
+    if (NULL == block)
+    {
+        return (FAIL);
+    }
+    memcpy(block + heap->arity - 1, heap->array, heap->size * sizeof(void *));
+    free(heap->block);
+    heap->block = block;
+    heap->array = block + heap->arity - 1;
+    heap->capacity = capacity;
+    return (SUCCESS);
 }
 
-static void *GetElement(bin_heap_t *bin_heap, size_t index)
+static void **AllocBlock(size_t capacity, size_t arity)
 {
-    return (*(void **)VectorAccessAt(((bin_heap_t *)bin_heap)->vector, index));
+    void *memory = NULL;
+    if (0 != posix_memalign(&memory, CACHE_LINE, (capacity + arity - 1) * sizeof(void *)))
+    {
+        return (NULL);
+    }
+    return ((void **)memory);
 }
 
-static int ReturnTrue(const void *data1, const void *data2)
+/* reuses a freed slot if there is one, otherwise adds a new one */
+static int TakeSlot(bin_heap_t *heap, unsigned int *slot)
 {
-    (void)data1;
-    (void)data2;
-    return (TRUE);
-}
\ No newline at end of file
+    size_t new_slot = 0;
+    if (NO_SLOT != heap->free_slot)
+    {
+        *slot = (unsigned int)heap->free_slot;
+        heap->free_slot = GetSlots(heap)[*slot];
+        return (SUCCESS);
+    }
+    new_slot = VectorGetSize(heap->slots);
+    if (NO_SLOT == new_slot || SUCCESS != VectorPushBack(heap->slots, &new_slot))
+    {
+        return (FAIL);
+    }
+    *slot = (unsigned int)new_slot;
+    return (SUCCESS);
+}
+
+static void SetSlot(size_t *slots, size_t slot, size_t index)
+{
+    if (NO_SLOT != slot)
+    {
+        slots[slot] = index;
+    }
+}
+
+static void FreeSlot(bin_heap_t *heap, size_t slot)
+{
+    GetSlots(heap)[slot] = heap->free_slot;
+    heap->free_slot = slot;
+}
+
+static void **GetArray(bin_heap_t *heap)
+{
+    return (heap->array);
+}
+
+static heap_meta_t *GetMeta(bin_heap_t *heap)
+{
+    return ((heap_meta_t *)VectorAccessAt(heap->meta, 0));
+}
+
+/* NULL while no handle was ever given */
+static size_t *GetSlots(bin_heap_t *heap)
+{
+    return ((NULL == heap->slots || 0 == VectorGetSize(heap->slots)) ?
+            NULL : (size_t *)VectorAccessAt(heap->slots, 0));
+}
@@ -0,0 +1,209 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#define _POSIX_C_SOURCE 200112L /* posix_memalign */
+
+#include <stdlib.h> /* posix_memalign, malloc, free */
+#include <string.h> /* memcpy */
+#include <assert.h> /* assert */
+
+#include "../include/key_heap.h"
+
+#define MAX(a,b) (((a)>(b))?(a):(b))
+#define CACHE_LINE 64
+#define MIN_CAPACITY 16
+#define GROWTH_FACTOR 2
+#define SUCCESS 0
+#define FAIL 1
+
+/*============================== DECLARATIONS ===============================*/
+
+typedef struct key_heap_entry
+{
+	unsigned long key;
+	void *data;
+}key_heap_entry_t;
+
+/*
+ * entries points arity - 1 entries into the aligned block, so the children
+ * of node i, entries[arity * i + 1] on, start at block[arity * (i + 1)] -
+ * always on a boundary of arity entries
+ */
+struct key_heap
+{
+	key_heap_entry_t *block;
+	key_heap_entry_t *entries;
+	size_t arity;
+	size_t size;
+	size_t capacity;
+};
+
+static key_heap_entry_t *AllocBlock(size_t, size_t);
+static int Grow(key_heap_t *);
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+key_heap_t *KeyHeapCreate(size_t arity, size_t capacity)
+{
+	key_heap_t *heap = NULL;
+
+	assert(2 <= arity);
+
+	heap = (key_heap_t *)malloc(sizeof(key_heap_t));
+	if (NULL == heap)
+	{
+		return (NULL);
+	}
+
+	heap->arity = arity;
+	heap->size = 0;
+	heap->capacity = MAX(capacity, MIN_CAPACITY);
+	heap->block = AllocBlock(heap->capacity, arity);
+	if (NULL == heap->block)
+	{
+		free(heap);
+		return (NULL);
+	}
+	heap->entries = heap->block + arity - 1;
+
+	return (heap);
+}
+
+void KeyHeapDestroy(key_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	free(heap->block);
+	free(heap);
+}
+
+/* the parents bigger than key move down into the hole until it fits */
+int KeyHeapPush(key_heap_t *heap, unsigned long key, void *data)
+{
+	key_heap_entry_t *entries = NULL;
+	size_t index = 0;
+	size_t parent = 0;
+
+	assert(NULL != heap);
+
+	if (heap->size == heap->capacity && SUCCESS != Grow(heap))
+	{
+		return (FAIL);
+	}
+
+	entries = heap->entries;
+	index = heap->size++;
+	while (0 < index)
+	{
+		parent = (index - 1) / heap->arity;
+		if (entries[parent].key <= key)
+		{
+			break;
+		}
+		entries[index] = entries[parent];
+		index = parent;
+	}
+	entries[index].key = key;
+	entries[index].data = data;
+
+	return (SUCCESS);
+}
+
+/* the last entry drops from the root, the smallest child moving up past it */
+void *KeyHeapPop(key_heap_t *heap)
+{
+	key_heap_entry_t *entries = NULL;
+	key_heap_entry_t moving;
+	void *top = NULL;
+	size_t index = 0;
+	size_t child = 0;
+	size_t runner = 0;
+	size_t end = 0;
+
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	entries = heap->entries;
+	top = entries[0].data;
+	moving = entries[--heap->size];
+	while ((child = heap->arity * index + 1) < heap->size)
+	{
+		end = (heap->size - child > heap->arity) ? child + heap->arity : heap->size;
+		for (runner = child + 1; runner < end; ++runner)
+		{
+			if (entries[runner].key < entries[child].key)
+			{
+				child = runner;
+			}
+		}
+		if (moving.key <= entries[child].key)
+		{
+			break;
+		}
+		entries[index] = entries[child];
+		index = child;
+	}
+	entries[index] = moving;
+
+	return (top);
+}
+
+void *KeyHeapPeek(const key_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	return (heap->entries[0].data);
+}
+
+unsigned long KeyHeapPeekKey(const key_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	return (heap->entries[0].key);
+}
+
+size_t KeyHeapSize(const key_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (heap->size);
+}
+
+int KeyHeapIsEmpty(const key_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (0 == heap->size);
+}
+
+/* aligned blocks cannot be realloc'ed, so growing copies to a new one */
+static int Grow(key_heap_t *heap)
+{
+	key_heap_entry_t *block = AllocBlock(heap->capacity * GROWTH_FACTOR, heap->arity);
+
+	if (NULL == block)
+	{
+		return (FAIL);
+	}
+
+	memcpy(block + heap->arity - 1, heap->entries, heap->size * sizeof(key_heap_entry_t));
+	free(heap->block);
+	heap->block = block;
+	heap->entries = block + heap->arity - 1;
+	heap->capacity *= GROWTH_FACTOR;
+
+	return (SUCCESS);
+}
+
+static key_heap_entry_t *AllocBlock(size_t capacity, size_t arity)
+{
+	void *memory = NULL;
+
+	if (0 != posix_memalign(&memory, CACHE_LINE, (capacity + arity - 1) * sizeof(key_heap_entry_t)))
+	{
+		return (NULL);
+	}
+
+	return ((key_heap_entry_t *)memory);
+}
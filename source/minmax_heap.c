@@ -0,0 +1,293 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#include <stdlib.h> /* malloc, free */
+#include <assert.h> /* assert */
+
+#include "../include/vector.h"
+#include "../include/minmax_heap.h"
+
+#define INIT_CAP 10
+#define ROOT 0
+#define SUCCESS 0
+#define FAIL 1
+#define TRUE 1
+#define FALSE 0
+
+/*============================== DECLARATIONS ===============================*/
+
+struct minmax_heap
+{
+	vector_t *vector;
+	minmax_cmp_func_t cmp;
+};
+
+static void *RemoveAt(minmax_heap_t *, size_t);
+static void SiftUp(minmax_heap_t *, size_t);
+static void SiftDown(minmax_heap_t *, size_t);
+static size_t GetBestDescendant(const minmax_heap_t *, void **, size_t, size_t, int);
+static size_t GetMaxIndex(const minmax_heap_t *);
+static int IsBetter(const minmax_heap_t *, int, const void *, const void *);
+static int IsMaxLevel(size_t);
+static void **GetArray(const minmax_heap_t *);
+static void Swap(void **, size_t, size_t);
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+minmax_heap_t *MinMaxHeapCreate(minmax_cmp_func_t cmp)
+{
+	minmax_heap_t *heap = NULL;
+
+	assert(NULL != cmp);
+
+	heap = (minmax_heap_t *)malloc(sizeof(minmax_heap_t));
+	if (NULL == heap)
+	{
+		return (NULL);
+	}
+
+	heap->vector = VectorCreate(INIT_CAP, sizeof(void *));
+	if (NULL == heap->vector)
+	{
+		free(heap);
+		return (NULL);
+	}
+
+	heap->cmp = cmp;
+
+	return (heap);
+}
+
+void MinMaxHeapDestroy(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	VectorDestroy(heap->vector);
+	free(heap);
+}
+
+int MinMaxHeapPush(minmax_heap_t *heap, void *data)
+{
+	assert(NULL != heap);
+
+	if (SUCCESS != VectorPushBack(heap->vector, &data))
+	{
+		return (FAIL);
+	}
+
+	SiftUp(heap, VectorGetSize(heap->vector) - 1);
+
+	return (SUCCESS);
+}
+
+void *MinMaxHeapPopMin(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!VectorIsEmpty(heap->vector));
+
+	return (RemoveAt(heap, ROOT));
+}
+
+void *MinMaxHeapPopMax(minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!VectorIsEmpty(heap->vector));
+
+	return (RemoveAt(heap, GetMaxIndex(heap)));
+}
+
+void *MinMaxHeapPeekMin(const minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!VectorIsEmpty(heap->vector));
+
+	return (GetArray(heap)[ROOT]);
+}
+
+void *MinMaxHeapPeekMax(const minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(!VectorIsEmpty(heap->vector));
+
+	return (GetArray(heap)[GetMaxIndex(heap)]);
+}
+
+size_t MinMaxHeapSize(const minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (VectorGetSize(heap->vector));
+}
+
+int MinMaxHeapIsEmpty(const minmax_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (VectorIsEmpty(heap->vector));
+}
+
+/* the last element fills the hole. it is written before the pop, which
+   may move the array when the vector shrinks */
+static void *RemoveAt(minmax_heap_t *heap, size_t index)
+{
+	void **array = GetArray(heap);
+	size_t last = VectorGetSize(heap->vector) - 1;
+	void *data = array[index];
+
+	array[index] = array[last];
+	VectorPopBack(heap->vector);
+
+	if (index < last)
+	{
+		SiftDown(heap, index);
+	}
+
+	return (data);
+}
+
+/* an element out of order with its parent belongs to the parent's kind of
+   level, so it swaps with it first. from there it only moves up by
+   grandparents, staying on levels of one kind */
+static void SiftUp(minmax_heap_t *heap, size_t index)
+{
+	void **array = GetArray(heap);
+	int is_max = IsMaxLevel(index);
+	size_t parent = 0;
+	size_t grandparent = 0;
+
+	if (ROOT == index)
+	{
+		return;
+	}
+
+	parent = (index - 1) / 2;
+	if (IsBetter(heap, !is_max, array[index], array[parent]))
+	{
+		Swap(array, index, parent);
+		index = parent;
+		is_max = !is_max;
+	}
+
+	while (2 < index)
+	{
+		grandparent = ((index - 1) / 2 - 1) / 2;
+		if (!IsBetter(heap, is_max, array[index], array[grandparent]))
+		{
+			break;
+		}
+
+		Swap(array, index, grandparent);
+		index = grandparent;
+	}
+}
+
+/*
+ * the element swaps with the best of its children and grandchildren by
+ * its level's order. a child has no descendants out of place, so that ends
+ * it; a grandchild's parent is on the other kind of level and may now be
+ * out of order with the element, which is fixed before going on down
+ */
+static void SiftDown(minmax_heap_t *heap, size_t index)
+{
+	void **array = GetArray(heap);
+	size_t size = VectorGetSize(heap->vector);
+	int is_max = IsMaxLevel(index);
+	size_t best = 0;
+	size_t parent = 0;
+
+	while (2 * index + 1 < size)
+	{
+		best = GetBestDescendant(heap, array, index, size, is_max);
+		if (!IsBetter(heap, is_max, array[best], array[index]))
+		{
+			break;
+		}
+
+		Swap(array, index, best);
+		if (best <= 2 * index + 2)
+		{
+			break;
+		}
+
+		parent = (best - 1) / 2;
+		if (IsBetter(heap, !is_max, array[best], array[parent]))
+		{
+			Swap(array, best, parent);
+		}
+		index = best;
+	}
+}
+
+/* index has at least one child */
+static size_t GetBestDescendant(const minmax_heap_t *heap, void **array, size_t index,
+                                size_t size, int is_max)
+{
+	size_t first_child = 2 * index + 1;
+	size_t first_grandchild = 2 * first_child + 1;
+	size_t best = first_child;
+	size_t i = 0;
+
+	if (first_child + 1 < size && IsBetter(heap, is_max, array[first_child + 1], array[best]))
+	{
+		best = first_child + 1;
+	}
+
+	for (i = first_grandchild; i < first_grandchild + 4 && i < size; ++i)
+	{
+		if (IsBetter(heap, is_max, array[i], array[best]))
+		{
+			best = i;
+		}
+	}
+
+	return (best);
+}
+
+/* the biggest is the root when alone, else the bigger of its children */
+static size_t GetMaxIndex(const minmax_heap_t *heap)
+{
+	void **array = GetArray(heap);
+	size_t size = VectorGetSize(heap->vector);
+
+	if (1 == size)
+	{
+		return (ROOT);
+	}
+	if (2 == size || !IsBetter(heap, TRUE, array[2], array[1]))
+	{
+		return (1);
+	}
+
+	return (2);
+}
+
+/* data1 belongs above data2 on a level of the given kind */
+static int IsBetter(const minmax_heap_t *heap, int is_max, const void *data1, const void *data2)
+{
+	return (is_max ? (0 < heap->cmp(data1, data2)) : (0 < heap->cmp(data2, data1)));
+}
+
+/* the root's level, 0, is a min level */
+static int IsMaxLevel(size_t index)
+{
+	int is_max = FALSE;
+
+	for (++index; 1 < index; index >>= 1)
+	{
+		is_max = !is_max;
+	}
+
+	return (is_max);
+}
+
+static void **GetArray(const minmax_heap_t *heap)
+{
+	return ((void **)VectorAccessAt(heap->vector, ROOT));
+}
+
+static void Swap(void **array, size_t index1, size_t index2)
+{
+	void *temp = array[index1];
+
+	array[index1] = array[index2];
+	array[index2] = temp;
+}
@@ -0,0 +1,354 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#define _POSIX_C_SOURCE 200112L /* posix_memalign, sched_yield */
+
+#include <stdlib.h> /* posix_memalign, free */
+#include <sched.h>  /* sched_yield */
+#include <assert.h> /* assert */
+
+#include "../include/heap.h"
+#include "../include/multi_pq.h"
+
+#define CACHE_LINE 64
+#define SUCCESS 0
+#define FAIL 1
+#define TRUE 1
+#define FALSE 0
+
+#define LOAD(ptr) (__atomic_load_n((ptr), __ATOMIC_ACQUIRE))
+#define STORE(ptr, val) (__atomic_store_n((ptr), (val), __ATOMIC_RELEASE))
+
+/*============================== DECLARATIONS ===============================*/
+
+/*
+ * size is written under the lock but read without it, so Size and the
+ * empty checks never wait. each queue fills a cache line of its own, so
+ * threads locking neighbouring queues do not slow each other down
+ */
+typedef struct multi_pq_queue
+{
+	bin_heap_t *heap;
+	size_t size;
+	unsigned char lock;
+	char padding[CACHE_LINE - sizeof(bin_heap_t *) - sizeof(size_t) - 1];
+}multi_pq_queue_t;
+
+struct multi_pq
+{
+	multi_pq_queue_t *queues;
+	size_t num_of_queues;
+	multi_pq_cmp_t cmp;
+	int is_strict;
+};
+
+static multi_pq_t *Create(multi_pq_cmp_t, size_t, int);
+static void *DequeueRelaxed(multi_pq_t *);
+static void *DequeueStrict(multi_pq_t *);
+static void *DequeueAny(multi_pq_t *);
+static multi_pq_queue_t *GetBetter(multi_pq_t *, multi_pq_queue_t *, multi_pq_queue_t *);
+static void *PopQueue(multi_pq_queue_t *);
+static size_t RandomIndex(size_t);
+static int TryLock(multi_pq_queue_t *);
+static void Lock(multi_pq_queue_t *);
+static void Unlock(multi_pq_queue_t *);
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+multi_pq_t *MultiPQCreate(multi_pq_cmp_t cmp, size_t num_of_queues)
+{
+	return (Create(cmp, num_of_queues, FALSE));
+}
+
+multi_pq_t *MultiPQCreateStrict(multi_pq_cmp_t cmp, size_t num_of_queues)
+{
+	return (Create(cmp, num_of_queues, TRUE));
+}
+
+void MultiPQDestroy(multi_pq_t *queue)
+{
+	size_t i = 0;
+
+	assert(NULL != queue);
+
+	for (i = 0; i < queue->num_of_queues; ++i)
+	{
+		BinHeapDestroy(queue->queues[i].heap);
+	}
+	free(queue->queues);
+	free(queue);
+}
+
+/* a busy queue is skipped rather than waited for. only when every try
+   in a round fails, as while a strict dequeue holds them all, the thread
+   yields */
+int MultiPQEnqueue(multi_pq_t *queue, void *data)
+{
+	multi_pq_queue_t *chosen = NULL;
+	size_t tries = 0;
+	int status = SUCCESS;
+
+	assert(NULL != queue);
+
+	chosen = &queue->queues[RandomIndex(queue->num_of_queues)];
+	while (!TryLock(chosen))
+	{
+		if (++tries == queue->num_of_queues)
+		{
+			tries = 0;
+			sched_yield();
+		}
+		chosen = &queue->queues[RandomIndex(queue->num_of_queues)];
+	}
+
+	status = BinHeapPush(chosen->heap, data);
+	if (SUCCESS == status)
+	{
+		STORE(&chosen->size, chosen->size + 1);
+	}
+	Unlock(chosen);
+
+	return (status);
+}
+
+void *MultiPQDequeue(multi_pq_t *queue)
+{
+	assert(NULL != queue);
+
+	return (queue->is_strict ? DequeueStrict(queue) : DequeueRelaxed(queue));
+}
+
+size_t MultiPQSize(const multi_pq_t *queue)
+{
+	size_t size = 0;
+	size_t i = 0;
+
+	assert(NULL != queue);
+
+	for (i = 0; i < queue->num_of_queues; ++i)
+	{
+		size += LOAD(&queue->queues[i].size);
+	}
+
+	return (size);
+}
+
+int MultiPQIsEmpty(const multi_pq_t *queue)
+{
+	assert(NULL != queue);
+
+	return (0 == MultiPQSize(queue));
+}
+
+static multi_pq_t *Create(multi_pq_cmp_t cmp, size_t num_of_queues, int is_strict)
+{
+	multi_pq_t *queue = NULL;
+	void *memory = NULL;
+	size_t i = 0;
+
+	assert(NULL != cmp);
+	assert(0 < num_of_queues);
+
+	queue = (multi_pq_t *)malloc(sizeof(multi_pq_t));
+	if (NULL == queue)
+	{
+		return (NULL);
+	}
+
+	if (0 != posix_memalign(&memory, CACHE_LINE, num_of_queues * sizeof(multi_pq_queue_t)))
+	{
+		free(queue);
+		return (NULL);
+	}
+
+	queue->queues = (multi_pq_queue_t *)memory;
+	queue->num_of_queues = num_of_queues;
+	queue->cmp = cmp;
+	queue->is_strict = is_strict;
+
+	for (i = 0; i < num_of_queues; ++i)
+	{
+		queue->queues[i].heap = BinHeapCreate(cmp);
+		queue->queues[i].size = 0;
+		queue->queues[i].lock = 0;
+		if (NULL == queue->queues[i].heap)
+		{
+			queue->num_of_queues = i;
+			MultiPQDestroy(queue);
+			return (NULL);
+		}
+	}
+
+	return (queue);
+}
+
+/*
+ * locks two random queues, without waiting, and pops the better top of
+ * the two. the tops are compared under the locks, since another thread
+ * may pop and free an element as soon as its queue is unlocked.
+ * when the picks keep coming up empty the queue may be nearly empty, so
+ * it is searched from the start instead
+ */
+static void *DequeueRelaxed(multi_pq_t *queue)
+{
+	multi_pq_queue_t *first = NULL;
+	multi_pq_queue_t *second = NULL;
+	multi_pq_queue_t *better = NULL;
+	void *data = NULL;
+	size_t misses = 0;
+
+	while (1 < queue->num_of_queues && misses < queue->num_of_queues)
+	{
+		first = &queue->queues[RandomIndex(queue->num_of_queues)];
+		second = &queue->queues[RandomIndex(queue->num_of_queues)];
+		if (first == second || (0 == LOAD(&first->size) && 0 == LOAD(&second->size)))
+		{
+			++misses;
+			continue;
+		}
+
+		if (!TryLock(first))
+		{
+			continue;
+		}
+		if (!TryLock(second))
+		{
+			Unlock(first);
+			continue;
+		}
+
+		better = GetBetter(queue, first, second);
+		if (NULL != better)
+		{
+			data = PopQueue(better);
+		}
+		Unlock(second);
+		Unlock(first);
+
+		if (NULL != better)
+		{
+			return (data);
+		}
+		++misses;
+	}
+
+	return (DequeueAny(queue));
+}
+
+/* every lock is taken in order, so the best top cannot change while found */
+static void *DequeueStrict(multi_pq_t *queue)
+{
+	multi_pq_queue_t *best = NULL;
+	void *data = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < queue->num_of_queues; ++i)
+	{
+		Lock(&queue->queues[i]);
+		best = GetBetter(queue, best, &queue->queues[i]);
+	}
+
+	if (NULL != best)
+	{
+		data = PopQueue(best);
+	}
+
+	for (i = 0; i < queue->num_of_queues; ++i)
+	{
+		Unlock(&queue->queues[i]);
+	}
+
+	return (data);
+}
+
+/* pops from the first queue found not empty */
+static void *DequeueAny(multi_pq_t *queue)
+{
+	multi_pq_queue_t *current = NULL;
+	void *data = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < queue->num_of_queues; ++i)
+	{
+		current = &queue->queues[i];
+		if (0 == LOAD(&current->size))
+		{
+			continue;
+		}
+
+		Lock(current);
+		if (0 != current->size)
+		{
+			data = PopQueue(current);
+			Unlock(current);
+			return (data);
+		}
+		Unlock(current);
+	}
+
+	return (NULL);
+}
+
+/* the one with the better top, NULL if both are empty. both are locked,
+   first may be NULL */
+static multi_pq_queue_t *GetBetter(multi_pq_t *queue, multi_pq_queue_t *first,
+                                   multi_pq_queue_t *second)
+{
+	if (NULL == first || 0 == first->size)
+	{
+		return ((0 == second->size) ? NULL : second);
+	}
+	if (0 == second->size)
+	{
+		return (first);
+	}
+
+	return ((0 > queue->cmp(BinHeapPeek(first->heap), BinHeapPeek(second->heap))) ?
+	        second : first);
+}
+
+/* the queue is locked and not empty */
+static void *PopQueue(multi_pq_queue_t *current)
+{
+	void *data = BinHeapPeek(current->heap);
+
+	BinHeapPop(current->heap);
+	STORE(&current->size, current->size - 1);
+
+	return (data);
+}
+
+/* xorshift with a state per thread, so picking a queue shares nothing.
+   a thread seeds it from the address of its own state */
+static size_t RandomIndex(size_t range)
+{
+	static __thread unsigned long state = 0;
+
+	if (0 == state)
+	{
+		state = (unsigned long)&state * 0x9E3779B97F4A7C15ul | 1;
+	}
+
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+
+	return ((size_t)(state % range));
+}
+
+static int TryLock(multi_pq_queue_t *current)
+{
+	return (!__atomic_test_and_set(&current->lock, __ATOMIC_ACQUIRE));
+}
+
+static void Lock(multi_pq_queue_t *current)
+{
+	while (__atomic_test_and_set(&current->lock, __ATOMIC_ACQUIRE))
+	{
+		sched_yield();
+	}
+}
+
+static void Unlock(multi_pq_queue_t *current)
+{
+	__atomic_clear(&current->lock, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,227 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#include <stdlib.h> /* malloc, free */
+#include <assert.h> /* assert */
+
+#include "../include/pairing_heap.h"
+
+#define SUCCESS 0
+#define FAIL 1
+
+/*============================== DECLARATIONS ===============================*/
+
+typedef struct pairing_node pairing_node_t;
+
+struct pairing_node
+{
+	void *data;
+	pairing_node_t *child;
+	pairing_node_t *sibling;
+};
+
+struct pairing_heap
+{
+	pairing_node_t *root;
+	size_t size;
+	pairing_cmp_func_t cmp;
+};
+
+static pairing_node_t *Link(pairing_heap_t *, pairing_node_t *, pairing_node_t *);
+static pairing_node_t *MergePairs(pairing_heap_t *, pairing_node_t *);
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+pairing_heap_t *PairingHeapCreate(pairing_cmp_func_t cmp)
+{
+	pairing_heap_t *heap = NULL;
+
+	assert(NULL != cmp);
+
+	heap = (pairing_heap_t *)malloc(sizeof(pairing_heap_t));
+	if (NULL == heap)
+	{
+		return (NULL);
+	}
+
+	heap->root = NULL;
+	heap->size = 0;
+	heap->cmp = cmp;
+
+	return (heap);
+}
+
+/*
+ * child and sibling are walked as the left and right of a binary tree:
+ * a node with a child is rotated right until it has none, then it is
+ * freed and the walk goes on to its sibling - no stack and no recursion
+ */
+void PairingHeapDestroy(pairing_heap_t *heap)
+{
+	pairing_node_t *node = NULL;
+	pairing_node_t *child = NULL;
+
+	assert(NULL != heap);
+
+	node = heap->root;
+	while (NULL != node)
+	{
+		if (NULL != node->child)
+		{
+			child = node->child;
+			node->child = child->sibling;
+			child->sibling = node;
+			node = child;
+		}
+		else
+		{
+			child = node->sibling;
+			free(node);
+			node = child;
+		}
+	}
+
+	free(heap);
+}
+
+int PairingHeapPush(pairing_heap_t *heap, void *data)
+{
+	pairing_node_t *node = NULL;
+
+	assert(NULL != heap);
+
+	node = (pairing_node_t *)malloc(sizeof(pairing_node_t));
+	if (NULL == node)
+	{
+		return (FAIL);
+	}
+
+	node->data = data;
+	node->child = NULL;
+	node->sibling = NULL;
+
+	heap->root = Link(heap, heap->root, node);
+	++heap->size;
+
+	return (SUCCESS);
+}
+
+void *PairingHeapPop(pairing_heap_t *heap)
+{
+	pairing_node_t *root = NULL;
+	void *data = NULL;
+
+	assert(NULL != heap);
+	assert(NULL != heap->root);
+
+	root = heap->root;
+	data = root->data;
+	heap->root = MergePairs(heap, root->child);
+	--heap->size;
+	free(root);
+
+	return (data);
+}
+
+void *PairingHeapPeek(const pairing_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(NULL != heap->root);
+
+	return (heap->root->data);
+}
+
+void PairingHeapMerge(pairing_heap_t *dest, pairing_heap_t *src)
+{
+	assert(NULL != dest);
+	assert(NULL != src);
+	assert(dest != src);
+
+	dest->root = Link(dest, dest->root, src->root);
+	dest->size += src->size;
+	src->root = NULL;
+	src->size = 0;
+}
+
+size_t PairingHeapSize(const pairing_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (heap->size);
+}
+
+int PairingHeapIsEmpty(const pairing_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (0 == heap->size);
+}
+
+/* the lower root becomes the first child of the upper one. either may be NULL */
+static pairing_node_t *Link(pairing_heap_t *heap, pairing_node_t *first, pairing_node_t *second)
+{
+	pairing_node_t *swap = NULL;
+
+	if (NULL == first || NULL == second)
+	{
+		return ((NULL == first) ? second : first);
+	}
+
+	if (0 > heap->cmp(first->data, second->data))
+	{
+		swap = first;
+		first = second;
+		second = swap;
+	}
+
+	second->sibling = first->child;
+	first->child = second;
+	first->sibling = NULL;
+
+	return (first);
+}
+
+/*
+ * the two pass pairing: the siblings are linked in pairs left to right,
+ * each pair pushed onto a list that comes out reversed, then the pairs are
+ * linked into one tree right to left
+ */
+static pairing_node_t *MergePairs(pairing_heap_t *heap, pairing_node_t *first)
+{
+	pairing_node_t *pairs = NULL;
+	pairing_node_t *pair = NULL;
+	pairing_node_t *next = NULL;
+
+	while (NULL != first)
+	{
+		next = first->sibling;
+		if (NULL == next)
+		{
+			first->sibling = pairs;
+			pairs = first;
+			break;
+		}
+
+		pair = first;
+		first = next->sibling;
+		pair = Link(heap, pair, next);
+		pair->sibling = pairs;
+		pairs = pair;
+	}
+
+	if (NULL == pairs)
+	{
+		return (NULL);
+	}
+
+	first = pairs;
+	pairs = pairs->sibling;
+	first->sibling = NULL;
+	while (NULL != pairs)
+	{
+		next = pairs->sibling;
+		first = Link(heap, first, pairs);
+		pairs = next;
+	}
+
+	return (first);
+}
@@ -13,23 +13,18 @@ struct pq_heap
 	bin_heap_t *heap;
 };
 
+typedef bin_heap_t *(*heap_create_t)(cmp_func_t);
+
+static pq_heap_t *Create(pq_heap_cmp_t, heap_create_t);
+
 pq_heap_t *PQHeapCreate(pq_heap_cmp_t func)
 {
-	pq_heap_t *queue = NULL;
-	assert(NULL != func);
-	queue = (pq_heap_t *)malloc(sizeof(pq_heap_t));
-
-	if (NULL != queue)
-	{
-		queue->heap = BinHeapCreate(func);
-		if (NULL == (queue->heap))
-		{
-			free(queue);
-			queue = NULL;
-		}
-	}
+	return (Create(func, BinHeapCreate));
+}
 
-	return (queue);
+pq_heap_t *PQHeapCreateStable(pq_heap_cmp_t func)
+{
+	return (Create(func, BinHeapCreateStable));
 }
 
 void PQHeapDestroy(pq_heap_t *queue)
@@ -71,6 +66,25 @@ void *PQHeapErase(pq_heap_t *queue, pq_heap_is_match_t is_match, const void *par
 	return (BinHeapRemove(queue->heap, is_match, (void *)param));
 }
 
+int PQHeapEnqueueHandle(pq_heap_t *queue, void *data, pq_heap_handle_t *handle)
+{
+	assert(NULL != queue);
+	assert(NULL != handle);
+	return (BinHeapPushHandle(queue->heap, data, handle));
+}
+
+void *PQHeapEraseHandle(pq_heap_t *queue, pq_heap_handle_t handle)
+{
+	assert(NULL != queue);
+	return (BinHeapRemoveHandle(queue->heap, handle));
+}
+
+void PQHeapUpdate(pq_heap_t *queue, pq_heap_handle_t handle)
+{
+	assert(NULL != queue);
+	BinHeapUpdate(queue->heap, handle);
+}
+
 void *PQHeapPeek(const pq_heap_t *queue)
 {
 	assert(NULL != queue);
@@ -88,3 +102,22 @@ size_t PQHeapSize(const pq_heap_t *queue)
 	assert(NULL != queue);
 	return (BinHeapSize(queue->heap));
 }
+
+static pq_heap_t *Create(pq_heap_cmp_t func, heap_create_t create_heap)
+{
+	pq_heap_t *queue = NULL;
+	assert(NULL != func);
+	queue = (pq_heap_t *)malloc(sizeof(pq_heap_t));
+
+	if (NULL != queue)
+	{
+		queue->heap = create_heap(func);
+		if (NULL == (queue->heap))
+		{
+			free(queue);
+			queue = NULL;
+		}
+	}
+
+	return (queue);
+}
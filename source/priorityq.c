@@ -55,6 +55,8 @@ void PriorityQClear(priority_q_t *queue)
 	}
 }
 
+/* the list puts data before the elements equal to it, and dequeue takes
+   from the back, so equal elements come out in the order they came in */
 int PriorityQEnqueue(priority_q_t *queue, void *data)
 {
 	assert(NULL != queue);
@@ -0,0 +1,335 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#include <stdlib.h> /* malloc, realloc, free */
+#include <limits.h> /* CHAR_BIT */
+#include <assert.h> /* assert */
+
+#include "../include/radix_heap.h"
+
+#define KEY_BITS (sizeof(unsigned long) * CHAR_BIT)
+#define NUM_OF_BUCKETS (KEY_BITS + 1)
+#define MIN_CAPACITY 16
+#define GROWTH_FACTOR 2
+#define NO_MIN NUM_OF_BUCKETS
+#define SUCCESS 0
+#define FAIL 1
+
+/*============================== DECLARATIONS ===============================*/
+
+typedef struct radix_entry
+{
+	unsigned long key;
+	void *data;
+}radix_entry_t;
+
+typedef struct radix_bucket
+{
+	radix_entry_t *entries;
+	size_t size;
+	size_t capacity;
+}radix_bucket_t;
+
+/*
+ * last only moves when an element is dequeued, to its key. min_bucket and
+ * min_index cache where the smallest entry is while bucket 0 is empty, or
+ * min_bucket is NO_MIN when that is not known
+ */
+struct radix_heap
+{
+	radix_bucket_t buckets[NUM_OF_BUCKETS];
+	unsigned long last;
+	size_t size;
+	size_t min_bucket;
+	size_t min_index;
+};
+
+static size_t GetBucketIndex(unsigned long, unsigned long);
+static int Reserve(radix_bucket_t *, size_t);
+static int PushToBucket(radix_bucket_t *, unsigned long, void *);
+static int FillFirstBucket(radix_heap_t *);
+static radix_entry_t *FindMin(radix_heap_t *);
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+radix_heap_t *RadixHeapCreate(void)
+{
+	radix_heap_t *heap = NULL;
+	size_t i = 0;
+
+	heap = (radix_heap_t *)malloc(sizeof(radix_heap_t));
+	if (NULL == heap)
+	{
+		return (NULL);
+	}
+
+	for (i = 0; i < NUM_OF_BUCKETS; ++i)
+	{
+		heap->buckets[i].entries = NULL;
+		heap->buckets[i].size = 0;
+		heap->buckets[i].capacity = 0;
+	}
+	heap->last = 0;
+	heap->size = 0;
+	heap->min_bucket = NO_MIN;
+	heap->min_index = 0;
+
+	return (heap);
+}
+
+void RadixHeapDestroy(radix_heap_t *heap)
+{
+	size_t i = 0;
+
+	assert(NULL != heap);
+
+	for (i = 0; i < NUM_OF_BUCKETS; ++i)
+	{
+		free(heap->buckets[i].entries);
+	}
+	free(heap);
+}
+
+int RadixHeapIsEmpty(const radix_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (0 == heap->size);
+}
+
+int RadixHeapEnqueue(radix_heap_t *heap, unsigned long key, void *data)
+{
+	size_t index = 0;
+	radix_bucket_t *bucket = NULL;
+
+	assert(NULL != heap);
+
+	if (key < heap->last)
+	{
+		return (FAIL);
+	}
+
+	index = GetBucketIndex(key, heap->last);
+	bucket = &heap->buckets[index];
+	if (SUCCESS != PushToBucket(bucket, key, data))
+	{
+		return (FAIL);
+	}
+	++heap->size;
+
+	if (NO_MIN != heap->min_bucket &&
+	    key < heap->buckets[heap->min_bucket].entries[heap->min_index].key)
+	{
+		heap->min_bucket = index;
+		heap->min_index = bucket->size - 1;
+	}
+
+	return (SUCCESS);
+}
+
+void *RadixHeapDequeue(radix_heap_t *heap)
+{
+	radix_bucket_t *first = NULL;
+
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	first = &heap->buckets[0];
+	if (0 == first->size && SUCCESS != FillFirstBucket(heap))
+	{
+		return (NULL);
+	}
+	--heap->size;
+
+	return (first->entries[--first->size].data);
+}
+
+void *RadixHeapPeek(radix_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	return (FindMin(heap)->data);
+}
+
+unsigned long RadixHeapPeekKey(radix_heap_t *heap)
+{
+	assert(NULL != heap);
+	assert(0 < heap->size);
+
+	return (FindMin(heap)->key);
+}
+
+size_t RadixHeapSize(const radix_heap_t *heap)
+{
+	assert(NULL != heap);
+
+	return (heap->size);
+}
+
+void RadixHeapClear(radix_heap_t *heap)
+{
+	size_t i = 0;
+
+	assert(NULL != heap);
+
+	for (i = 0; i < NUM_OF_BUCKETS; ++i)
+	{
+		heap->buckets[i].size = 0;
+	}
+	heap->last = 0;
+	heap->size = 0;
+	heap->min_bucket = NO_MIN;
+}
+
+/* the number of bits up to the highest one where key and last differ */
+static size_t GetBucketIndex(unsigned long key, unsigned long last)
+{
+	unsigned long diff = key ^ last;
+	size_t index = 0;
+
+	if (0 == diff)
+	{
+		return (0);
+	}
+#ifdef __GNUC__
+	index = KEY_BITS - (size_t)__builtin_clzl(diff);
+#else
+	for (; 0 != diff; diff >>= 1)
+	{
+		++index;
+	}
+#endif
+
+	return (index);
+}
+
+/* makes room for count more entries, at least doubling */
+static int Reserve(radix_bucket_t *bucket, size_t count)
+{
+	radix_entry_t *entries = NULL;
+	size_t capacity = bucket->capacity;
+
+	if (bucket->size + count <= capacity)
+	{
+		return (SUCCESS);
+	}
+
+	capacity = (0 == capacity) ? MIN_CAPACITY : capacity * GROWTH_FACTOR;
+	if (capacity < bucket->size + count)
+	{
+		capacity = bucket->size + count;
+	}
+
+	entries = (radix_entry_t *)realloc(bucket->entries, capacity * sizeof(radix_entry_t));
+	if (NULL == entries)
+	{
+		return (FAIL);
+	}
+	bucket->entries = entries;
+	bucket->capacity = capacity;
+
+	return (SUCCESS);
+}
+
+static int PushToBucket(radix_bucket_t *bucket, unsigned long key, void *data)
+{
+	if (SUCCESS != Reserve(bucket, 1))
+	{
+		return (FAIL);
+	}
+
+	bucket->entries[bucket->size].key = key;
+	bucket->entries[bucket->size].data = data;
+	++bucket->size;
+
+	return (SUCCESS);
+}
+
+/*
+ * the smallest key of the lowest non empty bucket becomes last, and every
+ * entry of that bucket moves to a lower one - they all agree with the new
+ * last on the bits above the bucket's, so none stays. room in the lower
+ * buckets is reserved before anything moves, so a failed allocation
+ * leaves the heap as it was
+ */
+static int FillFirstBucket(radix_heap_t *heap)
+{
+	size_t counts[NUM_OF_BUCKETS] = {0};
+	radix_bucket_t *bucket = NULL;
+	radix_entry_t *entries = NULL;
+	unsigned long last = 0;
+	size_t i = 1;
+
+	for (; 0 == heap->buckets[i].size; ++i)
+		;
+
+	bucket = &heap->buckets[i];
+	entries = bucket->entries;
+	last = entries[0].key;
+	for (i = 1; i < bucket->size; ++i)
+	{
+		if (entries[i].key < last)
+		{
+			last = entries[i].key;
+		}
+	}
+
+	for (i = 0; i < bucket->size; ++i)
+	{
+		++counts[GetBucketIndex(entries[i].key, last)];
+	}
+	for (i = 0; i < NUM_OF_BUCKETS; ++i)
+	{
+		if (0 != counts[i] && SUCCESS != Reserve(&heap->buckets[i], counts[i]))
+		{
+			return (FAIL);
+		}
+	}
+
+	heap->last = last;
+	for (i = 0; i < bucket->size; ++i)
+	{
+		PushToBucket(&heap->buckets[GetBucketIndex(entries[i].key, last)],
+		             entries[i].key, entries[i].data);
+	}
+	bucket->size = 0;
+	heap->min_bucket = NO_MIN;
+
+	return (SUCCESS);
+}
+
+/*
+ * keys in bucket 0 equal last, so any of them is the smallest. otherwise
+ * the smallest is in the lowest non empty bucket - found by a scan that
+ * moves nothing, so keys below it but not below last can still be
+ * enqueued. the place is cached until the buckets are split
+ */
+static radix_entry_t *FindMin(radix_heap_t *heap)
+{
+	radix_bucket_t *bucket = &heap->buckets[0];
+	size_t i = 1;
+
+	if (0 != bucket->size)
+	{
+		return (&bucket->entries[bucket->size - 1]);
+	}
+
+	if (NO_MIN == heap->min_bucket)
+	{
+		for (; 0 == heap->buckets[i].size; ++i)
+			;
+
+		bucket = &heap->buckets[i];
+		heap->min_bucket = i;
+		heap->min_index = 0;
+		for (i = 1; i < bucket->size; ++i)
+		{
+			if (bucket->entries[i].key < bucket->entries[heap->min_index].key)
+			{
+				heap->min_index = i;
+			}
+		}
+	}
+
+	return (&heap->buckets[heap->min_bucket].entries[heap->min_index]);
+}
@@ -0,0 +1,250 @@
+
+/*##########################LIBRARIES & MACROS#################################*/
+
+#include <stdlib.h> /* malloc, calloc, free */
+#include <stdint.h> /* uint16_t */
+#include <limits.h> /* CHAR_BIT */
+#include <assert.h> /* assert */
+
+#include "../include/rankselect.h"
+
+#define WORD_BITS (sizeof(bitarray_t) * CHAR_BIT)
+#define WORDS_IN_BLOCK 8
+#define BLOCK_BITS (WORDS_IN_BLOCK * WORD_BITS)
+#define BLOCKS_IN_SUPER 128
+#define SUPER_BITS (BLOCKS_IN_SUPER * BLOCK_BITS)
+#define SAMPLE_RATE 8192
+#define BYTE_MASK ((bitarray_t)0xFF)
+
+/*#############################DECLARATIONS####################################*/
+
+static size_t BlockRank(const rank_select_ptr_t, size_t);
+static size_t FindBlock(const rank_select_ptr_t, size_t);
+static size_t SelectInWord(bitarray_t, size_t);
+static size_t TrailingZeros(bitarray_t);
+static void FreeIndex(rank_select_ptr_t);
+
+/*############################# DEFINITIONS ###############################*/
+
+struct rank_select
+{
+	const bitarray_t *words;
+	size_t num_of_bits;
+	size_t num_of_blocks;
+	size_t total_on;
+	size_t *super_ranks;
+	uint16_t *block_ranks;
+	size_t num_of_samples;
+	size_t *select_samples;
+};
+
+rank_select_ptr_t RankSelectCreate(const bitvector_ptr_t vector)
+{
+	rank_select_ptr_t index = NULL;
+	size_t num_of_words = 0;
+	size_t block = 0;
+	size_t block_on = 0;
+	size_t words_in_block = 0;
+	size_t next_sample = 0;
+	size_t running = 0;
+
+	assert(NULL != vector);
+
+	index = (rank_select_ptr_t)calloc(1, sizeof(rank_select_t));
+
+	if (NULL == index)
+	{
+		return (NULL);
+	}
+
+	index->words = BitVectorGetWords(vector);
+	index->num_of_bits = BitVectorSize(vector);
+	num_of_words = (index->num_of_bits + WORD_BITS - 1) / WORD_BITS;
+	index->num_of_blocks = (index->num_of_bits + BLOCK_BITS - 1) / BLOCK_BITS;
+	index->total_on = BitArrayCountOnBulk(index->words, num_of_words);
+	index->num_of_samples = index->total_on / SAMPLE_RATE + 1;
+
+	/* one extra entry each, so rank works at position == num_of_bits */
+	index->super_ranks = (size_t *)malloc((index->num_of_blocks /
+	                        BLOCKS_IN_SUPER + 1) * sizeof(size_t));
+	index->block_ranks = (uint16_t *)malloc((index->num_of_blocks + 1) *
+	                                        sizeof(uint16_t));
+	index->select_samples = (size_t *)malloc(index->num_of_samples *
+	                                         sizeof(size_t));
+
+	if (NULL == index->super_ranks || NULL == index->block_ranks ||
+	    NULL == index->select_samples)
+	{
+		FreeIndex(index);
+		return (NULL);
+	}
+
+	index->select_samples[0] = 0;
+
+	for (block = 0; block <= index->num_of_blocks; ++block)
+	{
+		if (0 == block % BLOCKS_IN_SUPER)
+		{
+			index->super_ranks[block / BLOCKS_IN_SUPER] = running;
+		}
+
+		index->block_ranks[block] = (uint16_t)(running -
+		                      index->super_ranks[block / BLOCKS_IN_SUPER]);
+
+		if (block == index->num_of_blocks)
+		{
+			break;
+		}
+
+		words_in_block = num_of_words - block * WORDS_IN_BLOCK;
+		words_in_block = words_in_block < WORDS_IN_BLOCK ?
+		                 words_in_block : WORDS_IN_BLOCK;
+		block_on = BitArrayCountOnBulk(index->words + block * WORDS_IN_BLOCK,
+		                               words_in_block);
+
+		for (; next_sample < running + block_on; next_sample += SAMPLE_RATE)
+		{
+			index->select_samples[next_sample / SAMPLE_RATE] = block;
+		}
+
+		running += block_on;
+	}
+
+	return (index);
+}
+
+void RankSelectDestroy(rank_select_ptr_t index)
+{
+	assert(NULL != index);
+
+	FreeIndex(index);
+}
+
+size_t RankSelectRank(const rank_select_ptr_t index, size_t position)
+{
+	size_t block = position / BLOCK_BITS;
+	size_t word = position / WORD_BITS;
+	size_t bit = position % WORD_BITS;
+	size_t rank = 0;
+
+	assert(NULL != index);
+	assert(position <= index->num_of_bits);
+
+	rank = BlockRank(index, block) +
+	       BitArrayCountOnBulk(index->words + block * WORDS_IN_BLOCK,
+	                           word - block * WORDS_IN_BLOCK);
+
+	if (0 != bit)
+	{
+		rank += BitArrayCountOn(index->words[word] &
+		                        (((bitarray_t)1 << bit) - 1));
+	}
+
+	return (rank);
+}
+
+size_t RankSelectSelect(const rank_select_ptr_t index, size_t k)
+{
+	size_t block = 0;
+	size_t word = 0;
+	size_t word_on = 0;
+
+	assert(NULL != index);
+
+	if (k >= index->total_on)
+	{
+		return (index->num_of_bits);
+	}
+
+	block = FindBlock(index, k);
+	k -= BlockRank(index, block);
+	word = block * WORDS_IN_BLOCK;
+
+	/* the block holds the wanted bit, so this stops inside the vector */
+	for (word_on = BitArrayCountOn(index->words[word]); word_on <= k;
+	     word_on = BitArrayCountOn(index->words[word]))
+	{
+		k -= word_on;
+		++word;
+	}
+
+	return (word * WORD_BITS + SelectInWord(index->words[word], k));
+}
+
+size_t RankSelectCountOn(const rank_select_ptr_t index)
+{
+	assert(NULL != index);
+
+	return (index->total_on);
+}
+
+static size_t BlockRank(const rank_select_ptr_t index, size_t block)
+{
+	return (index->super_ranks[block / BLOCKS_IN_SUPER] +
+	        index->block_ranks[block]);
+}
+
+/* last block whose rank is <= k, searched between the surrounding samples */
+static size_t FindBlock(const rank_select_ptr_t index, size_t k)
+{
+	size_t sample = k / SAMPLE_RATE;
+	size_t low = index->select_samples[sample];
+	size_t high = index->num_of_blocks - 1;
+	size_t mid = 0;
+
+	if (sample + 1 < index->num_of_samples)
+	{
+		high = index->select_samples[sample + 1];
+	}
+
+	while (low < high)
+	{
+		mid = low + (high - low + 1) / 2;
+
+		if (BlockRank(index, mid) <= k)
+		{
+			low = mid;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+
+	return (low);
+}
+
+/* skips whole bytes by their count, then clears the k lowest on bits */
+static size_t SelectInWord(bitarray_t word, size_t k)
+{
+	size_t skipped = 0;
+	size_t byte_on = BitArrayCountOn(word & BYTE_MASK);
+
+	while (byte_on <= k)
+	{
+		k -= byte_on;
+		word >>= CHAR_BIT;
+		skipped += CHAR_BIT;
+		byte_on = BitArrayCountOn(word & BYTE_MASK);
+	}
+
+	for (; 0 < k; --k)
+	{
+		word &= word - 1;
+	}
+
+	return (skipped + TrailingZeros(word));
+}
+
+static size_t TrailingZeros(bitarray_t word)
+{
+	return (BitArrayCountOn((word & (~word + 1)) - 1));
+}
+
+static void FreeIndex(rank_select_ptr_t index)
+{
+	free(index->select_samples);
+	free(index->block_ranks);
+	free(index->super_ranks);
+	free(index);
+}
@@ -11,19 +11,23 @@
 
 #include "scheduler_heap.h"
 #include "pq_heap.h"
+#include "btree.h"
 
 /*============================== DECLARATIONS ===============================*/
 
+static int Schedule(scheduler_t*, task_t*);
 static int SortByTime(const void*, const void*);
-static int CompareByUID(const void*, const void*);
 static int CheckRunStatus(scheduler_t*);
 static void SleepTillReady(int);
 
 /*====================== STRUCT & FUNCTION DEFINITION =======================*/
 
+/* tasks indexes the queued tasks by UID, and each task keeps its handle
+   in queue, so a task is cancelled without a scan */
 struct scheduler
 {
 	pq_heap_t *queue;
+	btree_t *tasks;
 	int is_running;
 };
 
@@ -35,10 +39,19 @@ scheduler_t* HSchedulerCreate(void)
 	if(NULL != scheduler)
 	{
 		scheduler->is_running = FALSE;
-		scheduler->queue = PQHeapCreate(SortByTime);
+		scheduler->queue = PQHeapCreateStable(SortByTime);
+		scheduler->tasks = BTreeCreate(TaskOrderByUID);
 		
-		if(NULL == scheduler->queue)
+		if(NULL == scheduler->queue || NULL == scheduler->tasks)
 		{
+			if(NULL != scheduler->queue)
+			{
+				PQHeapDestroy(scheduler->queue);
+			}
+			if(NULL != scheduler->tasks)
+			{
+				BTreeDestroy(scheduler->tasks);
+			}
 			free(scheduler);
 			scheduler = NULL;
 		}
@@ -53,6 +66,8 @@ void HSchedulerDestroy(scheduler_t *scheduler)
     HSchedulerClear(scheduler);
     PQHeapDestroy(scheduler->queue);
     scheduler->queue = NULL;
+    BTreeDestroy(scheduler->tasks);
+    scheduler->tasks = NULL;
     free(scheduler);
 }
 
@@ -69,7 +84,7 @@ UID_t HSchedulerAddTask(scheduler_t *scheduler, action_func *func, void* param,
 	
 	if(NULL != new_task)
 	{
-		added_to_queue = PQHeapEnqueue(scheduler->queue, (void*)new_task);
+		added_to_queue = Schedule(scheduler, new_task);
 		
 		if(success != added_to_queue)
 		{
@@ -86,13 +101,15 @@ UID_t HSchedulerAddTask(scheduler_t *scheduler, action_func *func, void* param,
 
 int HSchedulerRemoveTask(scheduler_t *scheduler, UID_t uid)
 {
-	void *removed = NULL;
+	task_t *removed = NULL;
 	
 	assert(NULL != scheduler);
 	
-	removed = PQHeapErase(scheduler->queue, CompareByUID, (void*)&uid);
+	removed = (task_t*)BTreeFind(scheduler->tasks, &uid);
 	if(NULL != removed)
 	{
+		BTreeRemove(scheduler->tasks, &uid);
+		PQHeapEraseHandle(scheduler->queue, TaskGetHandle(removed));
 		TaskDestroy(removed);
 	}
 	return (NULL != removed);
@@ -104,7 +121,10 @@ void HSchedulerClear(scheduler_t *scheduler)
     
     while(!HSchedulerIsEmpty(scheduler))
     {
-        TaskDestroy(PQHeapDequeue(scheduler->queue));
+        task_t *task = (task_t*)PQHeapDequeue(scheduler->queue);
+        
+        BTreeRemove(scheduler->tasks, task);
+        TaskDestroy(task);
     }
 }
 
@@ -119,6 +139,9 @@ int HSchedulerRun(scheduler_t *scheduler)
 		task_t *curr_task = (task_t*)PQHeapDequeue(scheduler->queue);
 		int is_cyclic = -1;
 		
+		/* a running task is not in the scheduler - it cannot cancel itself */
+		BTreeRemove(scheduler->tasks, curr_task);
+		
 		SleepTillReady(TaskGetNextRunTime(curr_task) - time(0));
 		
 		is_cyclic = TaskRun(curr_task);
@@ -127,7 +150,7 @@ int HSchedulerRun(scheduler_t *scheduler)
 		{
 			TaskUpdateNextRunTime(curr_task);
 			
-			if(FAIL == PQHeapEnqueue(scheduler->queue, (void*)curr_task))
+			if(FAIL == Schedule(scheduler, curr_task))
 			{
 				TaskDestroy(curr_task);
 				break;
@@ -190,14 +213,29 @@ static void SleepTillReady(int time_delta)
 	}
 }
 
-static int SortByTime(const void *task, const void *task2)
+static int Schedule(scheduler_t *scheduler, task_t *task)
 {
-	return (TaskGetNextRunTime((task_t*)task2) - TaskGetNextRunTime((task_t*)task));
+	pq_heap_handle_t handle = 0;
+	
+	if(SUCCESS != BTreeInsert(scheduler->tasks, task))
+	{
+		return (FAIL);
+	}
+	
+	if(SUCCESS != PQHeapEnqueueHandle(scheduler->queue, (void*)task, &handle))
+	{
+		BTreeRemove(scheduler->tasks, task);
+		return (FAIL);
+	}
+	
+	TaskSetHandle(task, handle);
+	
+	return (SUCCESS);
 }
 
-static int CompareByUID(const void* task,const void* param)
+static int SortByTime(const void *task, const void *task2)
 {
-	return (TaskCompare((task_t*)task, *(UID_t*)param));
+	return (TaskGetNextRunTime((task_t*)task2) - TaskGetNextRunTime((task_t*)task));
 }
 
 
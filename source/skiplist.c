@@ -0,0 +1,563 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#define _POSIX_C_SOURCE 200112L /* sched_yield */
+
+#include <stdlib.h>  /* malloc, free */
+#include <pthread.h> /* pthread_mutex_t */
+#include <sched.h>   /* sched_yield */
+#include <assert.h>  /* assert */
+
+#include "../include/skiplist.h"
+
+#define MAX_LEVEL 32
+#define SUCCESS 0
+#define FAIL 1
+#define NOT_FOUND (-1)
+
+#define LOAD(ptr) (__atomic_load_n((ptr), __ATOMIC_ACQUIRE))
+#define STORE(ptr, val) (__atomic_store_n((ptr), (val), __ATOMIC_RELEASE))
+
+/*============================== DECLARATIONS ===============================*/
+
+/*
+ * a node is in the map once it is fully linked and until it is marked.
+ * next has level entries - the node is allocated to fit them
+ */
+struct skiplist_node
+{
+	void *data;
+	skiplist_node_t *retired_next;
+	int level;
+	int is_marked;
+	int is_fully_linked;
+	unsigned char lock;
+	skiplist_node_t *next[1];
+};
+
+struct skiplist
+{
+	skiplist_node_t *head;
+	cmp_func_t cmp_func;
+	size_t size;
+	unsigned long level_seed;
+	unsigned long epoch;
+	long readers[2];
+	pthread_mutex_t retired_lock;
+	skiplist_node_t *retired[2];
+};
+
+static int FindPath(skiplist_t*, const void*, skiplist_node_t*[], skiplist_node_t*[]);
+static int LockPreds(skiplist_node_t*[], skiplist_node_t*[], int, skiplist_node_t*);
+static void UnlockPreds(skiplist_node_t*[], int);
+static skiplist_node_t *SkipRemoved(skiplist_node_t*);
+static skiplist_node_t *CreateNode(void*, int);
+static int RandomLevel(skiplist_t*);
+static void Retire(skiplist_t*, skiplist_node_t*);
+static void FreeRetired(skiplist_node_t*);
+static void LockNode(skiplist_node_t*);
+static void UnlockNode(skiplist_node_t*);
+
+/*====================== STRUCT & FUNCTION DEFINITION =======================*/
+
+skiplist_t *SkipListCreate(cmp_func_t cmp_func)
+{
+	skiplist_t *list = NULL;
+	assert(NULL != cmp_func);
+	list = (skiplist_t *)malloc(sizeof(skiplist_t));
+
+	if (NULL == list)
+	{
+		return (NULL);
+	}
+
+	list->head = CreateNode(NULL, MAX_LEVEL);
+
+	if (NULL == list->head || 0 != pthread_mutex_init(&list->retired_lock, NULL))
+	{
+		free(list->head);
+		free(list);
+		return (NULL);
+	}
+
+	list->head->is_fully_linked = 1;
+	list->cmp_func = cmp_func;
+	list->size = 0;
+	list->level_seed = 0;
+	list->epoch = 0;
+	list->readers[0] = 0;
+	list->readers[1] = 0;
+	list->retired[0] = NULL;
+	list->retired[1] = NULL;
+
+	return (list);
+}
+
+void SkipListDestroy(skiplist_t *list)
+{
+	skiplist_node_t *node = NULL;
+	skiplist_node_t *next = NULL;
+	assert(NULL != list);
+
+	for (node = list->head; NULL != node; node = next)
+	{
+		next = node->next[0];
+		free(node);
+	}
+
+	FreeRetired(list->retired[0]);
+	FreeRetired(list->retired[1]);
+	pthread_mutex_destroy(&list->retired_lock);
+	free(list);
+}
+
+int SkipListInsert(skiplist_t *list, void *data)
+{
+	skiplist_node_t *preds[MAX_LEVEL];
+	skiplist_node_t *succs[MAX_LEVEL];
+	skiplist_node_t *new_node = NULL;
+	skiplist_node_t *found = NULL;
+	int level = 0;
+	int found_level = NOT_FOUND;
+	int ticket = 0;
+	int i = 0;
+	assert(NULL != list);
+
+	level = RandomLevel(list);
+	new_node = CreateNode(data, level);
+
+	if (NULL == new_node)
+	{
+		return (FAIL);
+	}
+
+	ticket = SkipListReadBegin(list);
+
+	while (1)
+	{
+		found_level = FindPath(list, data, preds, succs);
+
+		if (NOT_FOUND != found_level)
+		{
+			found = succs[found_level];
+
+			/* a marked node is on its way out - wait for it to go */
+			if (!LOAD(&found->is_marked))
+			{
+				while (!LOAD(&found->is_fully_linked))
+				{
+					sched_yield();
+				}
+
+				SkipListReadEnd(list, ticket);
+				free(new_node);
+				return (FAIL);
+			}
+
+			sched_yield();
+			continue;
+		}
+
+		if (!LockPreds(preds, succs, level, NULL))
+		{
+			continue;
+		}
+
+		for (i = 0; i < level; ++i)
+		{
+			new_node->next[i] = succs[i];
+		}
+
+		/* bottom up, so a node reachable at some level is reachable below */
+		for (i = 0; i < level; ++i)
+		{
+			STORE(&preds[i]->next[i], new_node);
+		}
+
+		STORE(&new_node->is_fully_linked, 1);
+		UnlockPreds(preds, level);
+		__atomic_add_fetch(&list->size, 1, __ATOMIC_RELAXED);
+		SkipListReadEnd(list, ticket);
+
+		return (SUCCESS);
+	}
+}
+
+void *SkipListRemove(skiplist_t *list, const void *key)
+{
+	skiplist_node_t *preds[MAX_LEVEL];
+	skiplist_node_t *succs[MAX_LEVEL];
+	skiplist_node_t *victim = NULL;
+	int found_level = NOT_FOUND;
+	int ticket = 0;
+	int i = 0;
+	assert(NULL != list);
+
+	ticket = SkipListReadBegin(list);
+
+	while (1)
+	{
+		found_level = FindPath(list, key, preds, succs);
+
+		if (NULL == victim)
+		{
+			if (NOT_FOUND == found_level)
+			{
+				SkipListReadEnd(list, ticket);
+				return (NULL);
+			}
+
+			victim = succs[found_level];
+
+			/* only a node found at its top level is known to be fully linked */
+			if (!LOAD(&victim->is_fully_linked) || victim->level - 1 != found_level)
+			{
+				victim = NULL;
+				sched_yield();
+				continue;
+			}
+
+			LockNode(victim);
+
+			if (victim->is_marked)
+			{
+				UnlockNode(victim);
+				SkipListReadEnd(list, ticket);
+				return (NULL);
+			}
+
+			/* from here on the element is out of the map for everyone */
+			STORE(&victim->is_marked, 1);
+		}
+
+		if (!LockPreds(preds, succs, victim->level, victim))
+		{
+			continue;
+		}
+
+		/* top down, so the node is never reachable above a level it left */
+		for (i = victim->level - 1; 0 <= i; --i)
+		{
+			__atomic_store_n(&preds[i]->next[i], victim->next[i], __ATOMIC_SEQ_CST);
+		}
+
+		UnlockNode(victim);
+		UnlockPreds(preds, victim->level);
+		__atomic_sub_fetch(&list->size, 1, __ATOMIC_RELAXED);
+		SkipListReadEnd(list, ticket);
+
+		key = victim->data;
+		Retire(list, victim);
+
+		return ((void *)key);
+	}
+}
+
+void *SkipListFind(skiplist_t *list, const void *key)
+{
+	skiplist_node_t *preds[MAX_LEVEL];
+	skiplist_node_t *succs[MAX_LEVEL];
+	skiplist_node_t *found = NULL;
+	void *data = NULL;
+	int found_level = NOT_FOUND;
+	int ticket = 0;
+	assert(NULL != list);
+
+	ticket = SkipListReadBegin(list);
+	found_level = FindPath(list, key, preds, succs);
+
+	if (NOT_FOUND != found_level)
+	{
+		found = succs[found_level];
+
+		if (LOAD(&found->is_fully_linked) && !LOAD(&found->is_marked))
+		{
+			data = found->data;
+		}
+	}
+
+	SkipListReadEnd(list, ticket);
+
+	return (data);
+}
+
+size_t SkipListSize(const skiplist_t *list)
+{
+	assert(NULL != list);
+
+	return (__atomic_load_n(&list->size, __ATOMIC_RELAXED));
+}
+
+/*
+ * the reader is counted under the current epoch's parity. if the epoch moved
+ * meanwhile, Retire may already have seen that count at 0 and freed nodes
+ * the reader could reach, so it counts itself again under the new epoch
+ */
+int SkipListReadBegin(skiplist_t *list)
+{
+	unsigned long epoch = 0;
+	int ticket = 0;
+	assert(NULL != list);
+
+	while (1)
+	{
+		epoch = __atomic_load_n(&list->epoch, __ATOMIC_SEQ_CST);
+		ticket = (int)(epoch & 1);
+		__atomic_add_fetch(&list->readers[ticket], 1, __ATOMIC_SEQ_CST);
+
+		if (epoch == __atomic_load_n(&list->epoch, __ATOMIC_SEQ_CST))
+		{
+			return (ticket);
+		}
+
+		__atomic_sub_fetch(&list->readers[ticket], 1, __ATOMIC_SEQ_CST);
+	}
+}
+
+void SkipListReadEnd(skiplist_t *list, int ticket)
+{
+	assert(NULL != list);
+	assert(0 == ticket || 1 == ticket);
+
+	__atomic_sub_fetch(&list->readers[ticket], 1, __ATOMIC_SEQ_CST);
+}
+
+skiplist_iter_t SkipListBegin(skiplist_t *list)
+{
+	assert(NULL != list);
+
+	return (SkipRemoved(LOAD(&list->head->next[0])));
+}
+
+skiplist_iter_t SkipListLowerBound(skiplist_t *list, const void *key)
+{
+	skiplist_node_t *preds[MAX_LEVEL];
+	skiplist_node_t *succs[MAX_LEVEL];
+	assert(NULL != list);
+
+	FindPath(list, key, preds, succs);
+
+	return (SkipRemoved(succs[0]));
+}
+
+skiplist_iter_t SkipListEnd(const skiplist_t *list)
+{
+	assert(NULL != list);
+	(void)list;
+
+	return (NULL);
+}
+
+skiplist_iter_t SkipListIterNext(skiplist_iter_t where)
+{
+	assert(NULL != where);
+
+	return (SkipRemoved(LOAD(&where->next[0])));
+}
+
+void *SkipListGetData(skiplist_iter_t where)
+{
+	assert(NULL != where);
+
+	return (where->data);
+}
+
+int SkipListIsEqual(skiplist_iter_t iter_one, skiplist_iter_t iter_two)
+{
+	return (iter_one == iter_two);
+}
+
+/*============================ STATIC FUNCTIONS =============================*/
+
+/*
+ * fills the last node before key and the first node not before it on every
+ * level. returns the highest level a node equal to key was met on
+ */
+static int FindPath(skiplist_t *list, const void *key,
+                    skiplist_node_t *preds[], skiplist_node_t *succs[])
+{
+	skiplist_node_t *pred = list->head;
+	skiplist_node_t *curr = NULL;
+	int found_level = NOT_FOUND;
+	int func_rtn = 0;
+	int level = 0;
+
+	for (level = MAX_LEVEL - 1; 0 <= level; --level)
+	{
+		curr = LOAD(&pred->next[level]);
+
+		while (NULL != curr && 0 < (func_rtn = list->cmp_func(key, curr->data)))
+		{
+			pred = curr;
+			curr = LOAD(&pred->next[level]);
+		}
+
+		if (NOT_FOUND == found_level && NULL != curr && 0 == func_rtn)
+		{
+			found_level = level;
+		}
+
+		preds[level] = pred;
+		succs[level] = curr;
+	}
+
+	return (found_level);
+}
+
+/*
+ * locks the preds of the lowest levels and checks nothing changed between
+ * them and their succs since FindPath. when victim is given it must be the
+ * succ; otherwise the succs must not be marked. unlocks all on failure
+ */
+static int LockPreds(skiplist_node_t *preds[], skiplist_node_t *succs[],
+                     int levels, skiplist_node_t *victim)
+{
+	skiplist_node_t *succ = NULL;
+	int is_valid = 1;
+	int level = 0;
+
+	for (level = 0; level < levels && is_valid; ++level)
+	{
+		if (0 == level || preds[level] != preds[level - 1])
+		{
+			LockNode(preds[level]);
+		}
+
+		succ = (NULL != victim) ? victim : succs[level];
+		is_valid = !LOAD(&preds[level]->is_marked) && preds[level]->next[level] == succ &&
+		           (NULL != victim || NULL == succ || !LOAD(&succ->is_marked));
+	}
+
+	if (!is_valid)
+	{
+		UnlockPreds(preds, level);
+	}
+
+	return (is_valid);
+}
+
+static void UnlockPreds(skiplist_node_t *preds[], int levels)
+{
+	int level = 0;
+
+	for (level = 0; level < levels; ++level)
+	{
+		if (0 == level || preds[level] != preds[level - 1])
+		{
+			UnlockNode(preds[level]);
+		}
+	}
+}
+
+/* first node from node on that is in the map */
+static skiplist_node_t *SkipRemoved(skiplist_node_t *node)
+{
+	while (NULL != node &&
+	       (LOAD(&node->is_marked) || !LOAD(&node->is_fully_linked)))
+	{
+		node = LOAD(&node->next[0]);
+	}
+
+	return (node);
+}
+
+static skiplist_node_t *CreateNode(void *data, int level)
+{
+	skiplist_node_t *node = (skiplist_node_t *)malloc(sizeof(skiplist_node_t) +
+	                         (level - 1) * sizeof(skiplist_node_t *));
+	int i = 0;
+
+	if (NULL != node)
+	{
+		node->data = data;
+		node->retired_next = NULL;
+		node->level = level;
+		node->is_marked = 0;
+		node->is_fully_linked = 0;
+		node->lock = 0;
+
+		for (i = 0; i < level; ++i)
+		{
+			node->next[i] = NULL;
+		}
+	}
+
+	return (node);
+}
+
+/* 1 + number of trailing ones of a mixed counter - each level half as likely */
+static int RandomLevel(skiplist_t *list)
+{
+	unsigned long bits = __atomic_add_fetch(&list->level_seed, 1, __ATOMIC_RELAXED);
+	int level = 1;
+
+	bits *= 0x9E3779B97F4A7C15ul;
+	bits ^= bits >> 29;
+	bits *= 0xBF58476D1CE4E5B9ul;
+	bits ^= bits >> 32;
+
+	while ((bits & 1) && level < MAX_LEVEL)
+	{
+		++level;
+		bits >>= 1;
+	}
+
+	return (level);
+}
+
+/*
+ * victim is unlinked, so a reader that enters now cannot reach it. it waits
+ * with the other nodes removed in the same epoch. the epoch moves on once no
+ * reader of the one before is left - they were the last that could hold
+ * that epoch's nodes, so those go. new readers only enter the current epoch,
+ * so readers that keep overlapping do not stop it from moving on, and at
+ * most two epochs of nodes wait. with no reader inside, two steps free
+ * victim too
+ */
+static void Retire(skiplist_t *list, skiplist_node_t *victim)
+{
+	skiplist_node_t *to_free[2] = {NULL, NULL};
+	unsigned long epoch = 0;
+	int i = 0;
+
+	pthread_mutex_lock(&list->retired_lock);
+	epoch = list->epoch;
+	victim->retired_next = list->retired[epoch & 1];
+	list->retired[epoch & 1] = victim;
+
+	for (i = 0; i < 2 &&
+	     0 == __atomic_load_n(&list->readers[(epoch + 1) & 1], __ATOMIC_SEQ_CST); ++i)
+	{
+		to_free[i] = list->retired[(epoch + 1) & 1];
+		list->retired[(epoch + 1) & 1] = NULL;
+		++epoch;
+		__atomic_store_n(&list->epoch, epoch, __ATOMIC_SEQ_CST);
+	}
+
+	pthread_mutex_unlock(&list->retired_lock);
+	FreeRetired(to_free[0]);
+	FreeRetired(to_free[1]);
+}
+
+static void FreeRetired(skiplist_node_t *node)
+{
+	skiplist_node_t *next = NULL;
+
+	for (; NULL != node; node = next)
+	{
+		next = node->retired_next;
+		free(node);
+	}
+}
+
+static void LockNode(skiplist_node_t *node)
+{
+	while (__atomic_test_and_set(&node->lock, __ATOMIC_ACQUIRE))
+	{
+		sched_yield();
+	}
+}
+
+static void UnlockNode(skiplist_node_t *node)
+{
+	__atomic_clear(&node->lock, __ATOMIC_RELEASE);
+}
@@ -6,9 +6,11 @@
 
 #include "task.h"
 
+/* uid must stay first - TaskOrderByUID reads tasks as UIDs */
 struct task
 {
 	UID_t uid;
+	size_t handle;
 	action_func *func;
 	void* param;
 	size_t interval_in_seconds;
@@ -23,6 +25,7 @@ task_t* TaskCreate(action_func *func, size_t interval_in_seconds, void *param)
 	if(NULL != task)
 	{
 		task->uid = UIDCreate();
+		task->handle = 0;
 		task->func = func;
 		task->param = param;
 		task->interval_in_seconds = MAX(interval_in_seconds, 1);
@@ -60,6 +63,41 @@ int TaskCompare(const task_t *task, UID_t uid)
 	return (UIDIsSame(task->uid, uid));
 }
 
+int TaskOrderByUID(const void *uid1, const void *uid2)
+{
+	const UID_t *first = (const UID_t*)uid1;
+	const UID_t *second = (const UID_t*)uid2;
+	
+	assert(NULL != uid1);
+	assert(NULL != uid2);
+	
+	if(first->counter != second->counter)
+	{
+		return ((first->counter < second->counter) ? -1 : 1);
+	}
+	
+	if(first->time != second->time)
+	{
+		return ((first->time < second->time) ? -1 : 1);
+	}
+	
+	return ((first->pid > second->pid) - (first->pid < second->pid));
+}
+
+void TaskSetHandle(task_t *task, size_t handle)
+{
+	assert(NULL != task);
+	
+	task->handle = handle;
+}
+
+size_t TaskGetHandle(const task_t *task)
+{
+	assert(NULL != task);
+	
+	return (task->handle);
+}
+
 time_t TaskGetNextRunTime(const task_t *task)
 {
 	assert(NULL != task);
@@ -0,0 +1,151 @@
+/*=========================== LIBRARIES & MACROS ============================*/
+
+#include <stdlib.h> /* malloc, free */
+#include <assert.h> /* assert */
+
+#include "../include/heap.h"
+#include "../include/topk.h"
+
+#define KEPT 1
+#define REJECTED 0
+#define SUCCESS 0
+
+/*============================== DECLARATIONS ===============================*/
+
+struct topk
+{
+	bin_heap_t *heap;
+	size_t k;
+	topk_cmp_t cmp;
+};
+
+/*====================== FUNCTION DEFINITION =======================*/
+
+topk_t *TopKCreate(topk_cmp_t cmp, size_t k)
+{
+	topk_t *topk = NULL;
+
+	assert(NULL != cmp);
+	assert(0 < k);
+
+	topk = (topk_t *)malloc(sizeof(topk_t));
+	if (NULL == topk)
+	{
+		return (NULL);
+	}
+
+	topk->heap = BinHeapCreateMin(cmp);
+	if (NULL == topk->heap || SUCCESS != BinHeapReserve(topk->heap, k))
+	{
+		if (NULL != topk->heap)
+		{
+			BinHeapDestroy(topk->heap);
+		}
+		free(topk);
+		return (NULL);
+	}
+
+	topk->k = k;
+	topk->cmp = cmp;
+
+	return (topk);
+}
+
+void TopKDestroy(topk_t *topk)
+{
+	assert(NULL != topk);
+
+	BinHeapDestroy(topk->heap);
+	free(topk);
+}
+
+/* the room for k elements was reserved, so the push does not allocate */
+int TopKOffer(topk_t *topk, void *data)
+{
+	assert(NULL != topk);
+
+	if (BinHeapSize(topk->heap) < topk->k)
+	{
+		return ((SUCCESS == BinHeapPush(topk->heap, data)) ? KEPT : REJECTED);
+	}
+
+	if (0 >= topk->cmp(data, BinHeapPeek(topk->heap)))
+	{
+		return (REJECTED);
+	}
+
+	BinHeapReplaceTop(topk->heap, data);
+
+	return (KEPT);
+}
+
+/* fills up to k first, then keeps the threshold in a local between offers */
+size_t TopKOfferBatch(topk_t *topk, void *elements[], size_t count)
+{
+	void *threshold = NULL;
+	size_t kept = 0;
+	size_t i = 0;
+
+	assert(NULL != topk);
+	assert(NULL != elements || 0 == count);
+
+	for (; i < count && BinHeapSize(topk->heap) < topk->k; ++i)
+	{
+		kept += (SUCCESS == BinHeapPush(topk->heap, elements[i]));
+	}
+
+	if (i == count)
+	{
+		return (kept);
+	}
+
+	threshold = BinHeapPeek(topk->heap);
+	for (; i < count; ++i)
+	{
+		if (0 < topk->cmp(elements[i], threshold))
+		{
+			BinHeapReplaceTop(topk->heap, elements[i]);
+			threshold = BinHeapPeek(topk->heap);
+			++kept;
+		}
+	}
+
+	return (kept);
+}
+
+void *TopKThreshold(const topk_t *topk)
+{
+	assert(NULL != topk);
+	assert(!BinHeapIsEmpty(topk->heap));
+
+	return (BinHeapPeek(topk->heap));
+}
+
+size_t TopKSize(const topk_t *topk)
+{
+	assert(NULL != topk);
+
+	return (BinHeapSize(topk->heap));
+}
+
+/* the min heap pops smallest first, so dest is filled from its end.
+   popping lets the heap shrink, so the room for k is reserved again */
+size_t TopKDrain(topk_t *topk, void *dest[])
+{
+	size_t size = 0;
+	size_t i = 0;
+
+	assert(NULL != topk);
+
+	size = BinHeapSize(topk->heap);
+	assert(NULL != dest || 0 == size);
+
+	for (i = size; 0 < i; --i)
+	{
+		dest[i - 1] = BinHeapPeek(topk->heap);
+		BinHeapPop(topk->heap);
+	}
+	BinHeapReserve(topk->heap, topk->k);
+
+	return (size);
+}
@@ -0,0 +1,203 @@
+#include <stdio.h> /* printf */
+
+#include "avl_arena.h"
+
+#define LARGE_SIZE 100000
+
+static int IntCompare(const void *data1, const void *data2);
+static int CheckOrder(void *data, void *param);
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestInsertFind();
+static void TestForEach();
+static void TestRemove();
+static void TestClear();
+
+static int values[LARGE_SIZE];
+
+int main()
+{
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestInsertFind();
+	TestForEach();
+	TestRemove();
+	TestClear();
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+/* starts small so the array has to grow many times on the way */
+static avl_arena_t *CreateFull()
+{
+	avl_arena_t *tree = AVLArenaCreate(IntCompare, 0);
+	size_t index = 0;
+	size_t i = 0;
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		index = (i * 7919) % LARGE_SIZE;
+		values[index] = (int)index;
+		AVLArenaInsert(tree, &values[index]);
+	}
+
+	return (tree);
+}
+
+static void TestCreate()
+{
+	avl_arena_t *tree = AVLArenaCreate(IntCompare, 100);
+
+	if(NULL != tree && AVLArenaIsEmpty(tree) && 0 == AVLArenaSize(tree) &&
+	   0 == AVLArenaHeight(tree))
+	{
+		printf("AVLArenaCreate working!                              V\n");
+	}
+	else
+	{
+		printf("AVLArenaCreate NOT working!                          X\n");
+	}
+
+	AVLArenaDestroy(tree);
+}
+
+static void TestInsertFind()
+{
+	avl_arena_t *tree = CreateFull();
+	int missing = LARGE_SIZE;
+	int is_working = 1;
+	size_t i = 0;
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && (&values[i] == AVLArenaFind(tree, &values[i]));
+	}
+
+	is_working = is_working && (NULL == AVLArenaFind(tree, &missing)) &&
+	             (LARGE_SIZE == AVLArenaSize(tree)) && (24 >= AVLArenaHeight(tree));
+
+	if(is_working)
+	{
+		printf("AVLArenaInsert & AVLArenaFind working!               V\n");
+	}
+	else
+	{
+		printf("AVLArenaInsert & AVLArenaFind NOT working!           X\n");
+	}
+
+	AVLArenaDestroy(tree);
+}
+
+static void TestForEach()
+{
+	avl_arena_t *tree = CreateFull();
+	int expected = 0;
+
+	if(0 == AVLArenaForEach(tree, CheckOrder, &expected) && LARGE_SIZE == expected)
+	{
+		printf("AVLArenaForEach working!                             V\n");
+	}
+	else
+	{
+		printf("AVLArenaForEach NOT working!                         X\n");
+	}
+
+	AVLArenaDestroy(tree);
+}
+
+static void TestRemove()
+{
+	avl_arena_t *tree = CreateFull();
+	int is_working = 1;
+	size_t index = 0;
+	size_t i = 0;
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		index = (i * 7919) % LARGE_SIZE;
+		if(1 == index % 2)
+		{
+			AVLArenaRemove(tree, &values[index]);
+		}
+	}
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && ((0 == i % 2) == (NULL != AVLArenaFind(tree, &values[i])));
+	}
+
+	is_working = is_working && (LARGE_SIZE / 2 == AVLArenaSize(tree)) &&
+	             (23 >= AVLArenaHeight(tree));
+
+	/* the freed nodes are reused */
+	for(i = 1; i < LARGE_SIZE; i += 2)
+	{
+		AVLArenaInsert(tree, &values[i]);
+	}
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		AVLArenaRemove(tree, &values[i]);
+	}
+
+	if(is_working && AVLArenaIsEmpty(tree) && 0 == AVLArenaHeight(tree))
+	{
+		printf("AVLArenaRemove working!                              V\n");
+	}
+	else
+	{
+		printf("AVLArenaRemove NOT working!                          X\n");
+	}
+
+	AVLArenaDestroy(tree);
+}
+
+static void TestClear()
+{
+	avl_arena_t *tree = CreateFull();
+	int is_working = 1;
+
+	AVLArenaClear(tree);
+
+	is_working = AVLArenaIsEmpty(tree) && (NULL == AVLArenaFind(tree, &values[5]));
+
+	AVLArenaInsert(tree, &values[5]);
+
+	is_working = is_working && (1 == AVLArenaSize(tree)) &&
+	             (&values[5] == AVLArenaFind(tree, &values[5]));
+
+	if(is_working)
+	{
+		printf("AVLArenaClear working!                               V\n");
+	}
+	else
+	{
+		printf("AVLArenaClear NOT working!                           X\n");
+	}
+
+	AVLArenaDestroy(tree);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}
+
+/* param holds the next expected value */
+static int CheckOrder(void *data, void *param)
+{
+	if(*(int *)data != *(int *)param)
+	{
+		return (1);
+	}
+
+	++*(int *)param;
+
+	return (0);
+}
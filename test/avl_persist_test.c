@@ -0,0 +1,249 @@
+#include <stdio.h>   /* printf */
+#include <pthread.h> /* pthread_create, pthread_join */
+
+#include "avl_persist.h"
+
+#define LARGE_SIZE 100000
+
+static int IntCompare(const void *data1, const void *data2);
+static int CheckOrder(void *data, void *param);
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestInsertFind();
+static void TestRemove();
+static void TestSnapshot();
+static void TestConcurrent();
+
+static int values[LARGE_SIZE];
+
+int main()
+{
+	size_t i = 0;
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[i] = (int)i;
+	}
+
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestInsertFind();
+	TestRemove();
+	TestSnapshot();
+	TestConcurrent();
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static avl_persist_t *CreateFull()
+{
+	avl_persist_t *tree = AVLPersistCreate(IntCompare);
+	size_t i = 0;
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		AVLPersistInsert(tree, &values[(i * 7919) % LARGE_SIZE]);
+	}
+
+	return (tree);
+}
+
+static void TestCreate()
+{
+	avl_persist_t *tree = AVLPersistCreate(IntCompare);
+
+	if(NULL != tree && AVLPersistIsEmpty(tree) && 0 == AVLPersistSize(tree) &&
+	   0 == AVLPersistHeight(tree))
+	{
+		printf("AVLPersistCreate working!                            V\n");
+	}
+	else
+	{
+		printf("AVLPersistCreate NOT working!                        X\n");
+	}
+
+	AVLPersistDestroy(tree);
+}
+
+static void TestInsertFind()
+{
+	avl_persist_t *tree = CreateFull();
+	int missing = LARGE_SIZE;
+	int expected = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && (&values[i] == AVLPersistFind(tree, &values[i]));
+	}
+
+	is_working = is_working && (NULL == AVLPersistFind(tree, &missing)) &&
+	             (LARGE_SIZE == AVLPersistSize(tree)) && (24 >= AVLPersistHeight(tree)) &&
+	             (0 == AVLPersistForEach(tree, CheckOrder, &expected)) && (LARGE_SIZE == expected);
+
+	if(is_working)
+	{
+		printf("AVLPersistInsert & AVLPersistFind working!           V\n");
+	}
+	else
+	{
+		printf("AVLPersistInsert & AVLPersistFind NOT working!       X\n");
+	}
+
+	AVLPersistDestroy(tree);
+}
+
+static void TestRemove()
+{
+	avl_persist_t *tree = CreateFull();
+	int is_working = 1;
+	size_t i = 0;
+
+	for(i = 1; i < LARGE_SIZE; i += 2)
+	{
+		is_working = is_working && (0 == AVLPersistRemove(tree, &values[i]));
+	}
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && ((0 == i % 2) == (NULL != AVLPersistFind(tree, &values[i])));
+	}
+
+	is_working = is_working && (LARGE_SIZE / 2 == AVLPersistSize(tree)) &&
+	             (23 >= AVLPersistHeight(tree));
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		AVLPersistRemove(tree, &values[i]);
+	}
+
+	if(is_working && AVLPersistIsEmpty(tree))
+	{
+		printf("AVLPersistRemove working!                            V\n");
+	}
+	else
+	{
+		printf("AVLPersistRemove NOT working!                        X\n");
+	}
+
+	AVLPersistDestroy(tree);
+}
+
+/* every version keeps what it had when it was taken */
+static void TestSnapshot()
+{
+	avl_persist_t *tree = CreateFull();
+	avl_persist_t *full = AVLPersistSnapshot(tree);
+	avl_persist_t *half = NULL;
+	int expected = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	for(i = 1; i < LARGE_SIZE; i += 2)
+	{
+		AVLPersistRemove(tree, &values[i]);
+	}
+
+	half = AVLPersistSnapshot(tree);
+
+	for(i = 0; i < LARGE_SIZE; i += 2)
+	{
+		AVLPersistRemove(tree, &values[i]);
+	}
+
+	is_working = AVLPersistIsEmpty(tree) && (LARGE_SIZE / 2 == AVLPersistSize(half)) &&
+	             (NULL == AVLPersistFind(half, &values[1])) &&
+	             (&values[2] == AVLPersistFind(half, &values[2]));
+
+	AVLPersistDestroy(tree);
+	AVLPersistInsert(half, &values[1]);
+
+	is_working = is_working && (LARGE_SIZE == AVLPersistSize(full)) &&
+	             (0 == AVLPersistForEach(full, CheckOrder, &expected)) &&
+	             (LARGE_SIZE == expected) && (LARGE_SIZE / 2 + 1 == AVLPersistSize(half));
+
+	if(is_working)
+	{
+		printf("AVLPersistSnapshot working!                          V\n");
+	}
+	else
+	{
+		printf("AVLPersistSnapshot NOT working!                      X\n");
+	}
+
+	AVLPersistDestroy(half);
+	AVLPersistDestroy(full);
+}
+
+/* reads its own snapshot while the main thread keeps changing the tree */
+static void *ReadSnapshot(void *param)
+{
+	avl_persist_t *snapshot = (avl_persist_t *)param;
+	int expected = 0;
+	size_t round = 0;
+	int is_working = 1;
+
+	for(round = 0; round < 5; ++round)
+	{
+		expected = 0;
+		is_working = is_working && (0 == AVLPersistForEach(snapshot, CheckOrder, &expected)) &&
+		             (LARGE_SIZE == expected);
+	}
+
+	AVLPersistDestroy(snapshot);
+
+	return (is_working ? snapshot : NULL);
+}
+
+static void TestConcurrent()
+{
+	avl_persist_t *tree = CreateFull();
+	pthread_t reader;
+	void *result = NULL;
+	size_t i = 0;
+
+	pthread_create(&reader, NULL, ReadSnapshot, AVLPersistSnapshot(tree));
+
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		AVLPersistRemove(tree, &values[(i * 7919) % LARGE_SIZE]);
+	}
+
+	pthread_join(reader, &result);
+
+	if(NULL != result && AVLPersistIsEmpty(tree))
+	{
+		printf("AVLPersist concurrent snapshot working!              V\n");
+	}
+	else
+	{
+		printf("AVLPersist concurrent snapshot NOT working!          X\n");
+	}
+
+	AVLPersistDestroy(tree);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}
+
+/* param holds the next expected value */
+static int CheckOrder(void *data, void *param)
+{
+	if(*(int *)data != *(int *)param)
+	{
+		return (1);
+	}
+
+	++*(int *)param;
+
+	return (0);
+}
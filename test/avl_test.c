@@ -1,7 +1,10 @@
 #include <stdio.h> /* printf */
+#include <string.h> /* memcmp */
 
 #include "avl.h"
 
+#define LARGE_SIZE 100000
+
 static int IntCompare(const void *data1, const void *data2);
 static int IntAdd(void *data, void *param);
 
@@ -13,6 +16,14 @@ static void TestRemove();
 static void TestDestroy();
 static void TestFind();
 static void TestForEach();
+static void TestLarge();
+static void TestSelectRank();
+static void TestRange();
+static void TestSplitJoin();
+static void TestTraversals();
+static void TestIter();
+static int Record(void *data, void *param);
+static int CheckOrder(void *data, void *param);
 
 
 int main()
@@ -30,6 +41,12 @@ static void TestAllFuncs()
 	TestSizeEmptyHeight();
 	TestFind();
 	TestForEach();
+	TestLarge();
+	TestSelectRank();
+	TestRange();
+	TestSplitJoin();
+	TestTraversals();
+	TestIter();
 	TestDestroy();
 	printf("      ~END OF TEST FUNCTION~ \n");
 }
@@ -229,6 +246,336 @@ static void TestForEach()
 	AVLDestroy(tree);
 }
 
+static void TestLarge()
+{
+	static int values[LARGE_SIZE];
+	int is_working = 1;
+	size_t index = 0;
+	size_t i = 0;
+	
+	avl_t *tree = AVLCreate(IntCompare);
+	
+	/* sorted input is the worst case for an unbalanced tree */
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[i] = (int)i;
+		AVLInsert(tree, &values[i]);
+	}
+	
+	is_working = (LARGE_SIZE == AVLSize(tree)) && (24 >= AVLHeight(tree));
+	
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		index = (i * 7919) % LARGE_SIZE;
+		if(1 == index % 2)
+		{
+			AVLRemove(tree, &values[index]);
+		}
+	}
+	
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && ((0 == i % 2) == (NULL != AVLFind(tree, &values[i])));
+	}
+	
+	is_working = is_working && (LARGE_SIZE / 2 == AVLSize(tree)) && (23 >= AVLHeight(tree));
+	
+	for(i = 0; i < LARGE_SIZE; i += 2)
+	{
+		AVLRemove(tree, &values[i]);
+	}
+	
+	if(is_working && AVLIsEmpty(tree))
+	{
+		printf("AVL large insert & remove working!                   V\n");
+	}
+	else
+	{
+		printf("AVL large insert & remove NOT working!               X\n");
+	}
+	
+	AVLDestroy(tree);
+}
+
+static void TestSelectRank()
+{
+	static int values[LARGE_SIZE];
+	int below_all = -1;
+	int above_all = 2 * LARGE_SIZE;
+	int odd = 501;
+	int is_working = 1;
+	size_t i = 0;
+	
+	avl_t *tree = AVLCreate(IntCompare);
+	
+	/* only even values, inserted in a scattered order */
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[(i * 7919) % LARGE_SIZE] = (int)((i * 7919) % LARGE_SIZE) * 2;
+		AVLInsert(tree, &values[(i * 7919) % LARGE_SIZE]);
+	}
+	
+	for(i = 0; i < LARGE_SIZE; i += 7)
+	{
+		is_working = is_working && (&values[i] == AVLSelect(tree, i)) &&
+		             (i == AVLRank(tree, &values[i]));
+	}
+	
+	is_working = is_working && (NULL == AVLSelect(tree, LARGE_SIZE)) &&
+	             (0 == AVLRank(tree, &below_all)) &&
+	             (LARGE_SIZE == AVLRank(tree, &above_all)) &&
+	             (251 == AVLRank(tree, &odd));
+	
+	AVLRemove(tree, &values[0]);
+	
+	is_working = is_working && (&values[1] == AVLSelect(tree, 0)) &&
+	             (LARGE_SIZE - 1 == AVLSize(tree));
+	
+	if(is_working)
+	{
+		printf("AVLSelect & AVLRank working!                         V\n");
+	}
+	else
+	{
+		printf("AVLSelect & AVLRank NOT working!                     X\n");
+	}
+	
+	AVLDestroy(tree);
+}
+
+static void TestRange()
+{
+	static int values[LARGE_SIZE];
+	int from = 1001;
+	int to = 90000;
+	int last = 2 * LARGE_SIZE - 2;
+	int past_end = 2 * LARGE_SIZE;
+	int first = 0;
+	int expected = 0;
+	int is_working = 1;
+	size_t i = 0;
+	
+	avl_t *tree = AVLCreate(IntCompare);
+	
+	/* only even values, inserted in a scattered order */
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[(i * 7919) % LARGE_SIZE] = (int)((i * 7919) % LARGE_SIZE) * 2;
+		AVLInsert(tree, &values[(i * 7919) % LARGE_SIZE]);
+	}
+	
+	is_working = (1002 == *(int *)AVLLowerBound(tree, &from)) &&
+	             (1002 == *(int *)AVLUpperBound(tree, &from)) &&
+	             (90000 == *(int *)AVLLowerBound(tree, &to)) &&
+	             (90002 == *(int *)AVLUpperBound(tree, &to)) &&
+	             (NULL == AVLUpperBound(tree, &last)) &&
+	             (NULL == AVLLowerBound(tree, &past_end));
+	
+	expected = 1002;
+	is_working = is_working &&
+	             (0 == AVLForEachRange(tree, &from, &to, CheckOrder, &expected)) &&
+	             (to == expected);
+	
+	expected = 0;
+	is_working = is_working &&
+	             (0 == AVLForEachRange(tree, &first, &past_end, CheckOrder, &expected)) &&
+	             (past_end == expected);
+	
+	/* an empty range does nothing, a failing action stops the walk */
+	expected = to;
+	is_working = is_working &&
+	             (0 == AVLForEachRange(tree, &to, &to, CheckOrder, &expected)) &&
+	             (to == expected);
+	
+	expected = 1000;
+	is_working = is_working &&
+	             (1 == AVLForEachRange(tree, &from, &to, CheckOrder, &expected)) &&
+	             (1000 == expected);
+	
+	if(is_working)
+	{
+		printf("AVL bounds & AVLForEachRange working!                V\n");
+	}
+	else
+	{
+		printf("AVL bounds & AVLForEachRange NOT working!            X\n");
+	}
+	
+	AVLDestroy(tree);
+}
+
+/* param holds the next expected value, the values go up by 2 */
+static int CheckOrder(void *data, void *param)
+{
+	if(*(int *)data != *(int *)param)
+	{
+		return (1);
+	}
+	
+	*(int *)param += 2;
+	
+	return (0);
+}
+
+static void TestSplitJoin()
+{
+	static int values[LARGE_SIZE];
+	static void *elements[LARGE_SIZE];
+	int key = LARGE_SIZE / 3;
+	int is_working = 1;
+	size_t i = 0;
+	avl_t *tree = NULL;
+	avl_t *right = NULL;
+	
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[i] = (int)i;
+		elements[i] = &values[i];
+	}
+	
+	tree = AVLCreateFromSorted(IntCompare, elements, LARGE_SIZE);
+	right = AVLCreate(IntCompare);
+	
+	/* 2^17 - 1 >= LARGE_SIZE, so a perfect build is 17 levels high */
+	is_working = (LARGE_SIZE == AVLSize(tree)) && (17 == AVLHeight(tree)) &&
+	             (&values[LARGE_SIZE / 2] == AVLSelect(tree, LARGE_SIZE / 2));
+	
+	AVLSplit(tree, &key, right);
+	
+	is_working = is_working && ((size_t)key == AVLSize(tree)) &&
+	             (LARGE_SIZE - key == (int)AVLSize(right)) &&
+	             (&values[key] == AVLSelect(right, 0)) &&
+	             (&values[key - 1] == AVLSelect(tree, key - 1)) &&
+	             (18 >= AVLHeight(tree)) && (18 >= AVLHeight(right));
+	
+	/* take the key back out of right and use it as the pivot */
+	AVLRemove(right, &values[key]);
+	AVLJoin(tree, &values[key], right);
+	
+	for(i = 0; i < LARGE_SIZE; i += 11)
+	{
+		is_working = is_working && (&values[i] == AVLSelect(tree, i));
+	}
+	
+	is_working = is_working && (LARGE_SIZE == AVLSize(tree)) && AVLIsEmpty(right) &&
+	             (24 >= AVLHeight(tree));
+	
+	if(is_working)
+	{
+		printf("AVLCreateFromSorted & AVLSplit & AVLJoin working!    V\n");
+	}
+	else
+	{
+		printf("AVLCreateFromSorted & AVLSplit & AVLJoin NOT working!X\n");
+	}
+	
+	AVLDestroy(right);
+	AVLDestroy(tree);
+}
+
+static void TestTraversals()
+{
+	int values[] = {4, 2, 6, 1, 3, 5, 7};
+	int pre[] = {4, 2, 1, 3, 6, 5, 7};
+	int in[] = {1, 2, 3, 4, 5, 6, 7};
+	int post[] = {1, 3, 2, 5, 7, 6, 4};
+	int record[8] = {0};
+	int is_working = 1;
+	size_t i = 0;
+	
+	avl_t *tree = AVLCreate(IntCompare);
+	
+	for(i = 0; i < 7; ++i)
+	{
+		AVLInsert(tree, &values[i]);
+	}
+	
+	record[0] = 1;
+	AVLForEach(tree, Record, record, PRE_ORDER);
+	is_working = (0 == memcmp(record + 1, pre, sizeof(pre)));
+	
+	record[0] = 1;
+	AVLForEach(tree, Record, record, IN_ORDER);
+	is_working = is_working && (0 == memcmp(record + 1, in, sizeof(in)));
+	
+	record[0] = 1;
+	AVLForEach(tree, Record, record, POST_ORDER);
+	is_working = is_working && (0 == memcmp(record + 1, post, sizeof(post)));
+	
+	if(is_working)
+	{
+		printf("AVLForEach PRE/IN/POST order working!                V\n");
+	}
+	else
+	{
+		printf("AVLForEach PRE/IN/POST order NOT working!            X\n");
+	}
+	
+	AVLDestroy(tree);
+}
+
+static void TestIter()
+{
+	static int values[LARGE_SIZE];
+	int expected = 0;
+	int is_working = 1;
+	avl_iter_t iter;
+	size_t i = 0;
+	
+	avl_t *tree = AVLCreate(IntCompare);
+	
+	AVLIterBegin(tree, &iter);
+	is_working = AVLIterIsEnd(&iter);
+	
+	for(i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[(i * 7919) % LARGE_SIZE] = (int)((i * 7919) % LARGE_SIZE);
+		AVLInsert(tree, &values[(i * 7919) % LARGE_SIZE]);
+	}
+	
+	for(AVLIterBegin(tree, &iter); !AVLIterIsEnd(&iter); AVLIterNext(&iter))
+	{
+		is_working = is_working && (expected == *(int *)AVLIterGetData(&iter));
+		++expected;
+	}
+	
+	is_working = is_working && (LARGE_SIZE == expected);
+	
+	for(AVLIterEnd(tree, &iter), AVLIterPrev(&iter); !AVLIterIsEnd(&iter); AVLIterPrev(&iter))
+	{
+		--expected;
+		is_working = is_working && (expected == *(int *)AVLIterGetData(&iter));
+	}
+	
+	/* the end sits between the biggest and the smallest element */
+	AVLIterNext(&iter);
+	is_working = is_working && (0 == expected) && (0 == *(int *)AVLIterGetData(&iter));
+	AVLIterPrev(&iter);
+	is_working = is_working && AVLIterIsEnd(&iter);
+	
+	if(is_working)
+	{
+		printf("AVLIter working!                                     V\n");
+	}
+	else
+	{
+		printf("AVLIter NOT working!                                 X\n");
+	}
+	
+	AVLDestroy(tree);
+}
+
+/* record[0] holds the next free index in record */
+static int Record(void *data, void *param)
+{
+	int *record = (int *)param;
+	
+	record[record[0]] = *(int *)data;
+	++record[0];
+	
+	return (0);
+}
+
 static int IntCompare(const void *data1, const void *data2)
 {
 	return (*(int *)data1 - *(int *)data2);
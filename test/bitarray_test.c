@@ -235,6 +235,70 @@ static void TestCountOff()
 	}
 }
 
+static void TestMirrorLoop()
+{
+	bitarray_t test = 1;
+	test = BitArrayMirrorLoop(test);
+	if (test == 0x8000000000000000 &&
+	    BitArrayMirrorLoop(0x0123456789ABCDEF) == BitArrayMirror(0x0123456789ABCDEF))
+	{
+		printf("BitArrayMirrorLoop working!           V\n");
+	}
+	else
+	{
+		printf("BitArrayMirrorLoop NOT working!       X\n");
+	}
+}
+
+static void TestCountOnLoop()
+{
+	bitarray_t test = 150;
+	size_t num = BitArrayCountOnLoop(test);
+	if (num == 4)
+	{
+		printf("BitArrayCountOnLoop working!          V\n");
+	}
+	else
+	{
+		printf("BitArrayCountOnLoop NOT working!      X\n");
+	}
+}
+
+static void TestCountOnBulk()
+{
+	bitarray_t arr[37] = {0};
+	size_t expected = 0;
+	size_t len = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < 37; ++i)
+	{
+		arr[i] = (bitarray_t)0x9E3779B97F4A7C15 * (i + 1);
+	}
+
+	for (len = 0; len <= 37; ++len)
+	{
+		expected = 0;
+
+		for (i = 0; i < len; ++i)
+		{
+			expected += BitArrayCountOnLoop(arr[i]);
+		}
+
+		is_working = is_working && (expected == BitArrayCountOnBulk(arr, len));
+	}
+
+	if (is_working)
+	{
+		printf("BitArrayCountOnBulk working!          V\n");
+	}
+	else
+	{
+		printf("BitArrayCountOnBulk NOT working!      X\n");
+	}
+}
+
 static void TestAllFuncs()
 {
 	TestSetAll();
@@ -249,8 +313,11 @@ static void TestAllFuncs()
 	TestMirror();
 	TestMirrorNoLoop();
 	TestMirrorLUT();
+	TestMirrorLoop();
 	TestCountOn();
+	TestCountOnLoop();
 	TestCountOnNoLoop();
 	TestCountOnLUT();
+	TestCountOnBulk();
 	TestCountOff();
 }
@@ -0,0 +1,184 @@
+#include <stdio.h>	/* printf */
+
+#include "bitvector.h"
+
+#define NUM_OF_BITS 1000
+
+static void TestAllFuncs();
+
+int main()
+{
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestCreate()
+{
+	bitvector_ptr_t vector = BitVectorCreate(NUM_OF_BITS);
+
+	if (NULL != vector && NUM_OF_BITS == BitVectorSize(vector) &&
+	    0 == BitVectorCountOn(vector, 0, NUM_OF_BITS))
+	{
+		printf("BitVectorCreate working!              V\n");
+	}
+	else
+	{
+		printf("BitVectorCreate NOT working!          X\n");
+	}
+
+	BitVectorDestroy(vector);
+}
+
+static void TestSingleBits()
+{
+	bitvector_ptr_t vector = BitVectorCreate(NUM_OF_BITS);
+	int is_working = 1;
+
+	BitVectorSetOn(vector, 0);
+	BitVectorSetOn(vector, 64);
+	BitVectorSetOn(vector, 999);
+	BitVectorFlip(vector, 500);
+	BitVectorFlip(vector, 64);
+	is_working = BitVectorGetVal(vector, 0) && BitVectorGetVal(vector, 999) &&
+	             BitVectorGetVal(vector, 500) && !BitVectorGetVal(vector, 64);
+	BitVectorSetOff(vector, 0);
+	is_working = is_working && !BitVectorGetVal(vector, 0) &&
+	             2 == BitVectorCountOn(vector, 0, NUM_OF_BITS);
+
+	if (is_working)
+	{
+		printf("BitVectorSetOn/Off & Flip working!    V\n");
+	}
+	else
+	{
+		printf("BitVectorSetOn/Off & Flip NOT working!X\n");
+	}
+
+	BitVectorDestroy(vector);
+}
+
+static void TestRanges()
+{
+	bitvector_ptr_t vector = BitVectorCreate(NUM_OF_BITS);
+	int is_working = 1;
+
+	BitVectorSetRangeOn(vector, 10, 300);
+	is_working = 290 == BitVectorCountOn(vector, 0, NUM_OF_BITS) &&
+	             !BitVectorGetVal(vector, 9) && BitVectorGetVal(vector, 10) &&
+	             BitVectorGetVal(vector, 299) && !BitVectorGetVal(vector, 300);
+	BitVectorSetRangeOff(vector, 64, 128);
+	is_working = is_working && 226 == BitVectorCountOn(vector, 0, NUM_OF_BITS);
+	BitVectorFlipRange(vector, 0, NUM_OF_BITS);
+	is_working = is_working && 774 == BitVectorCountOn(vector, 0, NUM_OF_BITS) &&
+	             64 == BitVectorCountOn(vector, 64, 128) &&
+	             3 == BitVectorCountOn(vector, 7, 13);
+
+	if (is_working)
+	{
+		printf("BitVector ranges & CountOn working!   V\n");
+	}
+	else
+	{
+		printf("BitVector ranges & CountOn NOT working!X\n");
+	}
+
+	BitVectorDestroy(vector);
+}
+
+static void TestFind()
+{
+	bitvector_ptr_t vector = BitVectorCreate(NUM_OF_BITS);
+	int is_working = 1;
+
+	is_working = NUM_OF_BITS == BitVectorFindFirstOn(vector, 0) &&
+	             0 == BitVectorFindFirstOff(vector, 0);
+	BitVectorSetOn(vector, 700);
+	BitVectorSetRangeOn(vector, 0, 130);
+	is_working = is_working && 5 == BitVectorFindFirstOn(vector, 5) &&
+	             130 == BitVectorFindFirstOff(vector, 0) &&
+	             700 == BitVectorFindFirstOn(vector, 130) &&
+	             NUM_OF_BITS == BitVectorFindFirstOn(vector, 701);
+	BitVectorSetRangeOn(vector, 0, NUM_OF_BITS);
+	is_working = is_working && NUM_OF_BITS == BitVectorFindFirstOff(vector, 0);
+
+	if (is_working)
+	{
+		printf("BitVectorFindFirstOn/Off working!     V\n");
+	}
+	else
+	{
+		printf("BitVectorFindFirstOn/Off NOT working! X\n");
+	}
+
+	BitVectorDestroy(vector);
+}
+
+static void TestResize()
+{
+	bitvector_ptr_t vector = BitVectorCreate(100);
+	int is_working = 1;
+
+	BitVectorSetRangeOn(vector, 0, 100);
+	is_working = 0 == BitVectorResize(vector, 70) &&
+	             70 == BitVectorCountOn(vector, 0, 70);
+	is_working = is_working && 0 == BitVectorResize(vector, 5000) &&
+	             70 == BitVectorCountOn(vector, 0, 5000) &&
+	             70 == BitVectorFindFirstOff(vector, 0) &&
+	             5000 == BitVectorFindFirstOn(vector, 70);
+
+	if (is_working)
+	{
+		printf("BitVectorResize working!              V\n");
+	}
+	else
+	{
+		printf("BitVectorResize NOT working!          X\n");
+	}
+
+	BitVectorDestroy(vector);
+}
+
+static void TestLogic()
+{
+	bitvector_ptr_t dest = BitVectorCreate(NUM_OF_BITS);
+	bitvector_ptr_t src = BitVectorCreate(NUM_OF_BITS);
+	int is_working = 1;
+
+	BitVectorSetRangeOn(dest, 0, 500);
+	BitVectorSetRangeOn(src, 250, 750);
+
+	BitVectorOr(dest, src);
+	is_working = 750 == BitVectorCountOn(dest, 0, NUM_OF_BITS);
+	BitVectorXor(dest, src);
+	is_working = is_working && 250 == BitVectorCountOn(dest, 0, NUM_OF_BITS) &&
+	             249 == BitVectorFindFirstOn(dest, 249);
+	BitVectorSetRangeOn(dest, 0, 500);
+	BitVectorAnd(dest, src);
+	is_working = is_working && 250 == BitVectorCountOn(dest, 0, NUM_OF_BITS) &&
+	             250 == BitVectorFindFirstOn(dest, 0);
+	BitVectorAndNot(src, dest);
+	is_working = is_working && 250 == BitVectorCountOn(src, 0, NUM_OF_BITS) &&
+	             500 == BitVectorFindFirstOn(src, 0);
+
+	if (is_working)
+	{
+		printf("BitVectorAnd/Or/Xor/AndNot working!   V\n");
+	}
+	else
+	{
+		printf("BitVectorAnd/Or/Xor/AndNot NOT working!X\n");
+	}
+
+	BitVectorDestroy(src);
+	BitVectorDestroy(dest);
+}
+
+static void TestAllFuncs()
+{
+	TestCreate();
+	TestSingleBits();
+	TestRanges();
+	TestFind();
+	TestResize();
+	TestLogic();
+}
@@ -2,6 +2,9 @@
 
 #include "bst.h"
 
+#define SPLIT_SIZE 1000
+#define BALANCED_SIZE 100000
+
 static int IntCompare(const void *data1, const void *data2);
 static int IntAdd(void *data, void *param);
 
@@ -15,6 +18,9 @@ static void TestIterFuncs();
 static void TestDestroy();
 static void TestFind();
 static void TestForEach();
+static void TestSplitJoin();
+static void TestArena();
+static void TestBalanced();
 
 
 int main()
@@ -34,6 +40,9 @@ static void TestAllFuncs()
 	TestSizeAndEmpty();
 	TestFind();
 	TestForEach();
+	TestSplitJoin();
+	TestArena();
+	TestBalanced();
 	TestDestroy();
 	printf("      ~END OF TEST FUNCTION~ \n");
 }
@@ -336,6 +345,157 @@ static void TestForEach()
 
 
 
+static void TestSplitJoin()
+{
+	static int values[SPLIT_SIZE];
+	static void *elements[SPLIT_SIZE];
+	int key = SPLIT_SIZE / 3;
+	int expected = 0;
+	int is_working = 1;
+	bst_iter_t runner = NULL;
+	bst_t *tree = NULL;
+	bst_t *right = NULL;
+	size_t i = 0;
+	
+	for(i = 0; i < SPLIT_SIZE; ++i)
+	{
+		values[i] = (int)i;
+		elements[i] = &values[i];
+	}
+	
+	tree = BSTCreateFromSorted(IntCompare, elements, SPLIT_SIZE);
+	right = BSTCreate(IntCompare);
+	
+	is_working = (SPLIT_SIZE == BSTSize(tree)) &&
+	             (&values[SPLIT_SIZE - 1] == BSTGetData(BSTFind(tree, &values[SPLIT_SIZE - 1])));
+	
+	BSTSplit(tree, &key, right);
+	
+	is_working = is_working && ((size_t)key == BSTSize(tree)) &&
+	             (SPLIT_SIZE - key == (int)BSTSize(right)) &&
+	             (key == *(int *)BSTGetData(BSTBegin(right))) &&
+	             (key - 1 == *(int *)BSTGetData(BSTIterPrev(BSTEnd(tree)))) &&
+	             (BSTIsEqual(BSTEnd(tree), BSTFind(tree, &values[key])));
+	
+	/* take the key back out of right and use it as the pivot */
+	BSTRemove(BSTBegin(right));
+	BSTJoin(tree, &values[key], right);
+	
+	for(runner = BSTBegin(tree); !BSTIsEqual(runner, BSTEnd(tree)); runner = BSTIterNext(runner))
+	{
+		is_working = is_working && (expected == *(int *)BSTGetData(runner));
+		++expected;
+	}
+	
+	is_working = is_working && (SPLIT_SIZE == expected) && BSTIsEmpty(right) &&
+	             (&values[key] == BSTGetData(BSTFind(tree, &values[key])));
+	
+	if(is_working)
+	{
+		printf("BSTCreateFromSorted & BSTSplit & BSTJoin working!    V\n");
+	}
+	else
+	{
+		printf("BSTCreateFromSorted & BSTSplit & BSTJoin NOT working!X\n");
+	}
+	
+	BSTDestroy(right);
+	BSTDestroy(tree);
+}
+
+static void TestArena()
+{
+	static int values[SPLIT_SIZE];
+	int expected = 0;
+	int is_working = 1;
+	bst_iter_t runner = NULL;
+	bst_t *tree = BSTCreateArena(IntCompare, 64);
+	size_t i = 0;
+	
+	for(i = 0; i < SPLIT_SIZE; ++i)
+	{
+		values[(i * 7) % SPLIT_SIZE] = (int)((i * 7) % SPLIT_SIZE);
+		BSTInsert(tree, &values[(i * 7) % SPLIT_SIZE]);
+	}
+	
+	/* remove the odd ones, then put them back into the freed nodes */
+	for(i = 1; i < SPLIT_SIZE; i += 2)
+	{
+		BSTRemove(BSTFind(tree, &values[i]));
+	}
+	
+	is_working = (SPLIT_SIZE / 2 == BSTSize(tree)) &&
+	             (BSTIsEqual(BSTEnd(tree), BSTFind(tree, &values[1])));
+	
+	for(i = 1; i < SPLIT_SIZE; i += 2)
+	{
+		BSTInsert(tree, &values[i]);
+	}
+	
+	for(runner = BSTBegin(tree); !BSTIsEqual(runner, BSTEnd(tree)); runner = BSTIterNext(runner))
+	{
+		is_working = is_working && (expected == *(int *)BSTGetData(runner));
+		++expected;
+	}
+	
+	if(is_working && SPLIT_SIZE == expected)
+	{
+		printf("BSTCreateArena working!                              V\n");
+	}
+	else
+	{
+		printf("BSTCreateArena NOT working!                          X\n");
+	}
+	
+	BSTDestroy(tree);
+}
+
+/* sorted input, which would make an unbalanced bst a list */
+static void TestBalanced()
+{
+	static int values[BALANCED_SIZE];
+	int expected = BALANCED_SIZE - 1;
+	int is_working = 1;
+	bst_iter_t runner = NULL;
+	bst_t *tree = BSTCreateBalanced(IntCompare);
+	size_t i = 0;
+	
+	for(i = 0; i < BALANCED_SIZE; ++i)
+	{
+		values[i] = (int)i;
+		BSTInsert(tree, &values[i]);
+	}
+	
+	for(i = 0; i < BALANCED_SIZE; ++i)
+	{
+		is_working = is_working && (&values[i] == BSTGetData(BSTFind(tree, &values[i])));
+	}
+	
+	for(i = 0; i < BALANCED_SIZE; i += 2)
+	{
+		BSTRemove(BSTFind(tree, &values[i]));
+	}
+	
+	is_working = is_working && (BALANCED_SIZE / 2 == BSTSize(tree));
+	
+	for(runner = BSTIterPrev(BSTEnd(tree)); !BSTIsEqual(runner, BSTEnd(tree)); runner = BSTIterPrev(runner))
+	{
+		is_working = is_working && (expected == *(int *)BSTGetData(runner));
+		expected -= 2;
+	}
+	
+	if(is_working && -1 == expected)
+	{
+		printf("BSTCreateBalanced working!                           V\n");
+	}
+	else
+	{
+		printf("BSTCreateBalanced NOT working!                       X\n");
+	}
+	
+	BSTDestroy(tree);
+}
+
 static int IntCompare(const void *data1, const void *data2)
 {
 	return (*(int *)data1 - *(int *)data2);
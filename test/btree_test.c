@@ -0,0 +1,269 @@
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc, free */
+
+#include "btree.h"
+
+#define NUM_OF_ELEMENTS 100000
+
+static int IntCompare(const void *data1, const void *data2);
+static int CheckOrder(void *data, void *param);
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestInsertFind();
+static void TestForEach();
+static void TestForEachRange();
+static void TestRemove();
+static void TestRemoveFreed();
+
+static int elements[NUM_OF_ELEMENTS];
+
+int main()
+{
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestInsertFind();
+	TestForEach();
+	TestForEachRange();
+	TestRemove();
+	TestRemoveFreed();
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+/* fills the tree in a scattered order - 7919 is prime, so every i shows up */
+static btree_t *CreateFull()
+{
+	btree_t *tree = BTreeCreate(IntCompare);
+	size_t i = 0;
+	size_t index = 0;
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		elements[i] = (int)i;
+	}
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		index = (i * 7919) % NUM_OF_ELEMENTS;
+		BTreeInsert(tree, &elements[index]);
+	}
+
+	return (tree);
+}
+
+static void TestCreate()
+{
+	btree_t *tree = BTreeCreate(IntCompare);
+
+	if (NULL != tree && BTreeIsEmpty(tree) && 0 == BTreeSize(tree) &&
+	    0 == BTreeHeight(tree))
+	{
+		printf("BTreeCreate working!                                 V\n");
+	}
+	else
+	{
+		printf("BTreeCreate NOT working!                             X\n");
+	}
+
+	BTreeDestroy(tree);
+}
+
+static void TestInsertFind()
+{
+	btree_t *tree = CreateFull();
+	int missing = NUM_OF_ELEMENTS;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		is_working = is_working && (&elements[i] == BTreeFind(tree, &elements[i]));
+	}
+
+	is_working = is_working && (NULL == BTreeFind(tree, &missing)) &&
+	             (1 == BTreeInsert(tree, &elements[5])) &&
+	             (NUM_OF_ELEMENTS == BTreeSize(tree)) &&
+	             (5 >= BTreeHeight(tree)) && (1 < BTreeHeight(tree));
+
+	if (is_working)
+	{
+		printf("BTreeInsert & BTreeFind working!                     V\n");
+	}
+	else
+	{
+		printf("BTreeInsert & BTreeFind NOT working!                 X\n");
+	}
+
+	BTreeDestroy(tree);
+}
+
+static void TestForEach()
+{
+	btree_t *tree = CreateFull();
+	int expected = 0;
+
+	if (0 == BTreeForEach(tree, CheckOrder, &expected) &&
+	    NUM_OF_ELEMENTS == expected)
+	{
+		printf("BTreeForEach working!                                V\n");
+	}
+	else
+	{
+		printf("BTreeForEach NOT working!                            X\n");
+	}
+
+	BTreeDestroy(tree);
+}
+
+static void TestForEachRange()
+{
+	btree_t *tree = CreateFull();
+	int from = 1234;
+	int to = 56789;
+	int past_end = NUM_OF_ELEMENTS + 10;
+	int expected = from;
+	int is_working = 1;
+
+	is_working = (0 == BTreeForEachRange(tree, &from, &to, CheckOrder,
+	                                     &expected)) && (to == expected);
+
+	/* the range may reach past the biggest element */
+	expected = from;
+	is_working = is_working && (0 == BTreeForEachRange(tree, &from, &past_end,
+	                            CheckOrder, &expected)) &&
+	             (NUM_OF_ELEMENTS == expected);
+
+	/* an empty range does nothing */
+	expected = to;
+	is_working = is_working && (0 == BTreeForEachRange(tree, &to, &to,
+	                            CheckOrder, &expected)) && (to == expected);
+
+	if (is_working)
+	{
+		printf("BTreeForEachRange working!                           V\n");
+	}
+	else
+	{
+		printf("BTreeForEachRange NOT working!                       X\n");
+	}
+
+	BTreeDestroy(tree);
+}
+
+static void TestRemove()
+{
+	btree_t *tree = CreateFull();
+	int expected = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	/* remove the odd elements in a scattered order, then check the rest */
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		if (1 == elements[(i * 7919) % NUM_OF_ELEMENTS] % 2)
+		{
+			BTreeRemove(tree, &elements[(i * 7919) % NUM_OF_ELEMENTS]);
+		}
+	}
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		is_working = is_working && ((0 == i % 2) ==
+		             (NULL != BTreeFind(tree, &elements[i])));
+	}
+
+	is_working = is_working && (NUM_OF_ELEMENTS / 2 == BTreeSize(tree));
+
+	for (i = 0; i < NUM_OF_ELEMENTS; i += 2)
+	{
+		BTreeRemove(tree, &elements[i]);
+		BTreeRemove(tree, &elements[i]);
+		is_working = is_working &&
+		             (NUM_OF_ELEMENTS / 2 - i / 2 - 1 == BTreeSize(tree));
+	}
+
+	is_working = is_working && BTreeIsEmpty(tree) && (0 == BTreeHeight(tree)) &&
+	             (0 == BTreeForEach(tree, CheckOrder, &expected)) &&
+	             (0 == expected) && (0 == BTreeInsert(tree, &elements[7])) &&
+	             (&elements[7] == BTreeFind(tree, &elements[7]));
+
+	if (is_working)
+	{
+		printf("BTreeRemove working!                                 V\n");
+	}
+	else
+	{
+		printf("BTreeRemove NOT working!                             X\n");
+	}
+
+	BTreeDestroy(tree);
+}
+
+/* every element is freed as soon as it is removed, while the tree keeps
+   being searched - run under vlg or asan to catch a separator left
+   pointing at a freed element */
+static void TestRemoveFreed()
+{
+	btree_t *tree = BTreeCreate(IntCompare);
+	int *element = NULL;
+	int key = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		element = (int *)malloc(sizeof(int));
+		*element = (int)((i * 7919) % NUM_OF_ELEMENTS);
+		BTreeInsert(tree, element);
+	}
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		key = (int)((i * 104729) % NUM_OF_ELEMENTS);
+		element = (int *)BTreeFind(tree, &key);
+		is_working = is_working && (NULL != element) && (key == *element);
+		BTreeRemove(tree, &key);
+		free(element);
+
+		key = (int)((i * 15485863) % NUM_OF_ELEMENTS);
+		element = (int *)BTreeFind(tree, &key);
+		is_working = is_working && (NULL == element || key == *element);
+	}
+
+	is_working = is_working && BTreeIsEmpty(tree);
+
+	if (is_working)
+	{
+		printf("BTreeRemove with freed elements working!             V\n");
+	}
+	else
+	{
+		printf("BTreeRemove with freed elements NOT working!         X\n");
+	}
+
+	BTreeDestroy(tree);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}
+
+/* param holds the next expected value */
+static int CheckOrder(void *data, void *param)
+{
+	if (*(int *)data != *(int *)param)
+	{
+		return (1);
+	}
+
+	++*(int *)param;
+
+	return (0);
+}
@@ -1,13 +1,23 @@
+#include <pthread.h> /* pthread_create, pthread_join */
 #include <stdio.h> /* printf */
 #include <string.h> /* strcmp */
 
 #include "../include/circbuff.h"
 
 void TestAllFuncs();
+void TestZeroCopy();
+void TestPolicies();
+void TestBlocking();
+static void *Produce(void *);
+
+#define STREAM_SIZE 100000
 
 int main()
 {
 	TestAllFuncs();
+	TestZeroCopy();
+	TestPolicies();
+	TestBlocking();
 	return (0);
 }
 
@@ -102,18 +112,196 @@ void TestAllFuncs()
 	CircBuffDestroy(circbuff);
 }
 
+void TestZeroCopy()
+{
+	char str[27] = "abcdefghijklmnopqrstuvwxyz";
+	char to_cmp[27] = " ";
+	char *span = NULL;
+	const char *read_span = NULL;
+	size_t span_size = 0;
+	int is_working = 1;
+	
+	circbuff_ptr_t circbuff = CircBuffCreate(20);
+	circbuff_ptr_t mirrored = CircBuffCreateMirrored(20);
+	
+	span = CircBuffReserve(circbuff, 15, &span_size);
+	memcpy(span, str, span_size);
+	CircBuffCommit(circbuff, span_size);
+	is_working = is_working && (15 == span_size) && (15 == CircBuffSize(circbuff));
+	
+	read_span = CircBuffPeek(circbuff, &span_size);
+	is_working = is_working && (15 == span_size) && 
+	             (0 == strncmp(read_span, str, 15));
+	CircBuffConsume(circbuff, 10);
+	
+	/* regular buffer spans stop at the wrap */
+	span = CircBuffReserve(circbuff, 10, &span_size);
+	is_working = is_working && (5 == span_size);
+	memcpy(span, str + 15, span_size);
+	CircBuffCommit(circbuff, span_size);
+	span = CircBuffReserve(circbuff, 10, &span_size);
+	is_working = is_working && (10 == span_size);
+	memcpy(span, str + 20, 6);
+	CircBuffCommit(circbuff, 6);
+	
+	read_span = CircBuffPeek(circbuff, &span_size);
+	is_working = is_working && (10 == span_size) && (16 == CircBuffSize(circbuff));
+	CircBuffRead(circbuff, to_cmp, 16);
+	is_working = is_working && (0 == strncmp(to_cmp, str + 10, 16));
+	
+	if (is_working)
+	{
+		printf("CircBuffReserve & CircBuffCommit & Peek working!     V\n");
+	}
+	else
+	{
+		printf("CircBuffReserve & CircBuffCommit & Peek NOT working! X\n");
+	}
+	
+	is_working = (NULL != mirrored);
+	
+	if (is_working)
+	{
+		size_t capacity = CircBuffFreeSpace(mirrored);
+		
+		span = CircBuffReserve(mirrored, capacity, &span_size);
+		CircBuffCommit(mirrored, capacity - 10);
+		CircBuffConsume(mirrored, capacity - 10);
+		
+		/* mirrored spans run across the wrap */
+		span = CircBuffReserve(mirrored, 26, &span_size);
+		is_working = is_working && (26 == span_size);
+		memcpy(span, str, 26);
+		CircBuffCommit(mirrored, 26);
+		read_span = CircBuffPeek(mirrored, &span_size);
+		is_working = is_working && (26 == span_size) && 
+		             (0 == strncmp(read_span, str, 26));
+		CircBuffConsume(mirrored, 20);
+		
+		CircBuffWrite(mirrored, str, 26);
+		CircBuffRead(mirrored, to_cmp, 6);
+		is_working = is_working && (0 == strncmp(to_cmp, str + 20, 6));
+		CircBuffRead(mirrored, to_cmp, 26);
+		is_working = is_working && (0 == strncmp(to_cmp, str, 26)) && 
+		             CircBuffIsEmpty(mirrored);
+		
+		CircBuffDestroy(mirrored);
+	}
+	
+	if (is_working)
+	{
+		printf("CircBuffCreateMirrored working!                      V\n");
+	}
+	else
+	{
+		printf("CircBuffCreateMirrored NOT working!                  X\n");
+	}
+	
+	CircBuffDestroy(circbuff);
+}
 
+void TestPolicies()
+{
+	char str[27] = "abcdefghijklmnopqrstuvwxyz";
+	char to_cmp[27] = " ";
+	int is_working = 1;
+	
+	circbuff_ptr_t circbuff = CircBuffCreate(10);
+	
+	CircBuffSetPolicy(circbuff, CB_FAIL, -1);
+	is_working = is_working && (-1 == CircBuffWrite(circbuff, str, 11));
+	is_working = is_working && CircBuffIsEmpty(circbuff);
+	is_working = is_working && (8 == CircBuffWrite(circbuff, str, 8));
+	is_working = is_working && (-1 == CircBuffWrite(circbuff, str, 3));
+	
+	if (is_working)
+	{
+		printf("CB_FAIL working!                                     V\n");
+	}
+	else
+	{
+		printf("CB_FAIL NOT working!                                 X\n");
+	}
+	
+	CircBuffSetPolicy(circbuff, CB_SHORT_WRITE, -1);
+	is_working = (2 == CircBuffWrite(circbuff, str + 8, 5));
+	is_working = is_working && (0 == CircBuffWrite(circbuff, str, 5));
+	is_working = is_working && (10 == CircBuffRead(circbuff, to_cmp, 26));
+	is_working = is_working && (0 == strncmp(to_cmp, str, 10));
+	
+	if (is_working)
+	{
+		printf("CB_SHORT_WRITE working!                              V\n");
+	}
+	else
+	{
+		printf("CB_SHORT_WRITE NOT working!                          X\n");
+	}
+	
+	CircBuffSetPolicy(circbuff, CB_BLOCK, 10);
+	is_working = (10 == CircBuffWrite(circbuff, str, 26));
+	is_working = is_working && (10 == CircBuffRead(circbuff, to_cmp, 26));
+	is_working = is_working && (0 == CircBuffRead(circbuff, to_cmp, 26));
+	
+	if (is_working)
+	{
+		printf("CB_BLOCK timeout working!                            V\n");
+	}
+	else
+	{
+		printf("CB_BLOCK timeout NOT working!                        X\n");
+	}
+	
+	CircBuffDestroy(circbuff);
+}
 
+static void *Produce(void *circbuff)
+{
+	size_t i = 0;
+	unsigned char byte = 0;
+	
+	for (i = 0; i < STREAM_SIZE; ++i)
+	{
+		byte = (unsigned char)i;
+		CircBuffWrite((circbuff_ptr_t)circbuff, &byte, 1);
+	}
+	
+	return (NULL);
+}
 
-
-
-
-
-
-
-
-
-
-
-
-
+void TestBlocking()
+{
+	static unsigned char received[STREAM_SIZE];
+	size_t total = 0;
+	size_t i = 0;
+	int is_working = 1;
+	pthread_t producer;
+	
+	circbuff_ptr_t circbuff = CircBuffCreate(64);
+	CircBuffSetPolicy(circbuff, CB_BLOCK, -1);
+	
+	pthread_create(&producer, NULL, Produce, circbuff);
+	
+	while (total < STREAM_SIZE)
+	{
+		total += CircBuffRead(circbuff, received + total, STREAM_SIZE - total);
+	}
+	
+	pthread_join(producer, NULL);
+	
+	for (i = 0; i < STREAM_SIZE; ++i)
+	{
+		is_working = is_working && (received[i] == (unsigned char)i);
+	}
+	
+	if (is_working && CircBuffIsEmpty(circbuff))
+	{
+		printf("CB_BLOCK producer/consumer working!                  V\n");
+	}
+	else
+	{
+		printf("CB_BLOCK producer/consumer NOT working!              X\n");
+	}
+	
+	CircBuffDestroy(circbuff);
+}
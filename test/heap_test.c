@@ -1,6 +1,8 @@
 #include <stdio.h> /* printf */
 #include "heap.h"
 
+#define HANDLE_SIZE 1000
+
 static void TestAllFuncs();
 static void TestCreate();
 static void TestDestroy();
@@ -9,6 +11,11 @@ static void TestPop();
 static void TestPeek();
 static void TestRemove();
 static void TestSizeEmpty();
+static void TestHandles();
+static void TestLateHandles();
+static void TestDary();
+static void TestFromArray();
+static void TestMinReplaceTop();
 static int IntCompare(const void *num1, const void *num2);
 static int IntMatch(const void *num1, const void *num2);
 
@@ -27,6 +34,11 @@ static void TestAllFuncs()
     TestPeek();
     TestSizeEmpty();
     TestRemove();
+    TestHandles();
+    TestLateHandles();
+    TestDary();
+    TestFromArray();
+    TestMinReplaceTop();
     TestDestroy();
     printf("      ~END OF TEST FUNCTION~ \n");
 }
@@ -214,6 +226,240 @@ static void TestRemove()
     BinHeapDestroy(heap);
 }
 
+static void TestHandles()
+{
+    static int values[HANDLE_SIZE];
+    bin_heap_handle_t handles[HANDLE_SIZE];
+    int is_working = 1;
+    int last = HANDLE_SIZE * 2;
+    size_t i = 0;
+    bin_heap_t *heap = BinHeapCreate(IntCompare);
+
+    for (i = 0; i < HANDLE_SIZE; ++i)
+    {
+        values[i] = (int)((i * 7919) % HANDLE_SIZE);
+        BinHeapPushHandle(heap, &values[i], &handles[i]);
+    }
+
+    /* every third key goes up, every third one goes away */
+    for (i = 0; i + 1 < HANDLE_SIZE; i += 3)
+    {
+        values[i] += HANDLE_SIZE;
+        BinHeapUpdate(heap, handles[i]);
+        is_working = is_working && (&values[i + 1] == BinHeapRemoveHandle(heap, handles[i + 1]));
+    }
+
+    /* the freed handles are given again */
+    for (i = 1; i < HANDLE_SIZE; i += 3)
+    {
+        values[i] = -1;
+        BinHeapPushHandle(heap, &values[i], &handles[i]);
+        is_working = is_working && (&values[i] == BinHeapGetData(heap, handles[i]));
+    }
+
+    is_working = is_working && (HANDLE_SIZE == BinHeapSize(heap));
+
+    while (!BinHeapIsEmpty(heap))
+    {
+        is_working = is_working && (last >= *(int *)BinHeapPeek(heap));
+        last = *(int *)BinHeapPeek(heap);
+        BinHeapPop(heap);
+    }
+
+    if (is_working && -1 == last)
+    {
+        printf("BinHeap handles working!                             V\n");
+    }
+    else
+    {
+        printf("BinHeap handles NOT working!                         X\n");
+    }
+
+    BinHeapDestroy(heap);
+}
+
+/* handles given only after plain pushes, which then start being tracked */
+static void TestLateHandles()
+{
+    static int values[HANDLE_SIZE];
+    bin_heap_handle_t handles[HANDLE_SIZE];
+    int is_working = 1;
+    int expected = HANDLE_SIZE - 1;
+    size_t i = 0;
+    bin_heap_t *heap = BinHeapCreate(IntCompare);
+
+    for (i = 0; i < HANDLE_SIZE; ++i)
+    {
+        values[i] = (int)((i * 7919) % HANDLE_SIZE);
+    }
+
+    for (i = 0; i < HANDLE_SIZE / 2; ++i)
+    {
+        BinHeapPush(heap, &values[i]);
+    }
+
+    /* the other half goes in twice too big, and is moved back by handle */
+    for (i = HANDLE_SIZE / 2; i < HANDLE_SIZE; ++i)
+    {
+        values[i] += HANDLE_SIZE;
+        is_working = is_working && (0 == BinHeapPushHandle(heap, &values[i], &handles[i]));
+    }
+
+    for (i = HANDLE_SIZE / 2; i < HANDLE_SIZE; ++i)
+    {
+        values[i] -= HANDLE_SIZE;
+        BinHeapUpdate(heap, handles[i]);
+        is_working = is_working && (&values[i] == BinHeapGetData(heap, handles[i]));
+    }
+
+    for (; !BinHeapIsEmpty(heap); --expected)
+    {
+        is_working = is_working && (expected == *(int *)BinHeapPeek(heap));
+        BinHeapPop(heap);
+    }
+
+    if (is_working && -1 == expected)
+    {
+        printf("BinHeap handles after plain pushes working!          V\n");
+    }
+    else
+    {
+        printf("BinHeap handles after plain pushes NOT working!      X\n");
+    }
+
+    BinHeapDestroy(heap);
+}
+
+static void TestDary()
+{
+    static int values[HANDLE_SIZE];
+    bin_heap_handle_t handle = 0;
+    int is_working = 1;
+    int expected = HANDLE_SIZE - 1;
+    size_t i = 0;
+    bin_heap_t *heap = BinHeapCreateDary(IntCompare, 4);
+
+    for (i = 0; i < HANDLE_SIZE; ++i)
+    {
+        values[i] = (int)((i * 7919) % HANDLE_SIZE);
+        BinHeapPushHandle(heap, &values[i], &handle);
+    }
+
+    /* the last one pushed becomes the biggest */
+    values[HANDLE_SIZE - 1] = HANDLE_SIZE;
+    BinHeapUpdate(heap, handle);
+    is_working = (&values[HANDLE_SIZE - 1] == BinHeapPeek(heap));
+    values[HANDLE_SIZE - 1] = (int)(((HANDLE_SIZE - 1) * 7919) % HANDLE_SIZE);
+    BinHeapUpdate(heap, handle);
+
+    for (; !BinHeapIsEmpty(heap); --expected)
+    {
+        is_working = is_working && (expected == *(int *)BinHeapPeek(heap));
+        BinHeapPop(heap);
+    }
+
+    if (is_working && -1 == expected)
+    {
+        printf("BinHeapCreateDary working!                           V\n");
+    }
+    else
+    {
+        printf("BinHeapCreateDary NOT working!                       X\n");
+    }
+
+    BinHeapDestroy(heap);
+}
+
+static void TestFromArray()
+{
+    static int values[HANDLE_SIZE];
+    static int more[HANDLE_SIZE / 10];
+    void *elements[HANDLE_SIZE];
+    int is_working = 1;
+    int expected = HANDLE_SIZE - 1;
+    size_t i = 0;
+    bin_heap_t *heap = NULL;
+
+    for (i = 0; i < HANDLE_SIZE; ++i)
+    {
+        values[i] = (int)((i * 7919) % HANDLE_SIZE);
+        elements[i] = &values[i];
+    }
+
+    /* the first half is heapified, the second half is at least as many so
+       it heapifies again, and the last tenth sifts up one by one */
+    heap = BinHeapCreateFromArray(IntCompare, elements, HANDLE_SIZE / 2);
+    is_working = (NULL != heap) &&
+                 (0 == BinHeapPushAll(heap, elements + HANDLE_SIZE / 2, HANDLE_SIZE / 2));
+
+    for (i = 0; i < HANDLE_SIZE / 10; ++i)
+    {
+        more[i] = HANDLE_SIZE + (int)i;
+        elements[i] = &more[i];
+    }
+    is_working = is_working && (0 == BinHeapPushAll(heap, elements, HANDLE_SIZE / 10)) &&
+                 (HANDLE_SIZE + HANDLE_SIZE / 10 == BinHeapSize(heap));
+
+    for (expected = HANDLE_SIZE + HANDLE_SIZE / 10 - 1; !BinHeapIsEmpty(heap); --expected)
+    {
+        is_working = is_working && (expected == *(int *)BinHeapPeek(heap));
+        BinHeapPop(heap);
+    }
+
+    if (is_working && -1 == expected)
+    {
+        printf("BinHeapCreateFromArray & BinHeapPushAll working!     V\n");
+    }
+    else
+    {
+        printf("BinHeapCreateFromArray & BinHeapPushAll NOT working! X\n");
+    }
+
+    BinHeapDestroy(heap);
+}
+
+/* keeps the HANDLE_SIZE / 10 biggest values, smallest of them on top */
+static void TestMinReplaceTop()
+{
+    static int values[HANDLE_SIZE];
+    int is_working = 1;
+    int expected = 0;
+    size_t i = 0;
+    bin_heap_t *heap = BinHeapCreateMin(IntCompare);
+
+    is_working = (NULL != heap) && (0 == BinHeapReserve(heap, HANDLE_SIZE / 10));
+
+    for (i = 0; i < HANDLE_SIZE; ++i)
+    {
+        values[i] = (int)((i * 7919) % HANDLE_SIZE);
+        if (BinHeapSize(heap) < HANDLE_SIZE / 10)
+        {
+            BinHeapPush(heap, &values[i]);
+        }
+        else if (values[i] > *(int *)BinHeapPeek(heap))
+        {
+            is_working = is_working && (values[i] > *(int *)BinHeapReplaceTop(heap, &values[i]));
+        }
+    }
+
+    for (expected = HANDLE_SIZE - HANDLE_SIZE / 10; !BinHeapIsEmpty(heap); ++expected)
+    {
+        is_working = is_working && (expected == *(int *)BinHeapPeek(heap));
+        BinHeapPop(heap);
+    }
+
+    if (is_working && HANDLE_SIZE == expected)
+    {
+        printf("BinHeapCreateMin & BinHeapReplaceTop working!        V\n");
+    }
+    else
+    {
+        printf("BinHeapCreateMin & BinHeapReplaceTop NOT working!    X\n");
+    }
+
+    BinHeapDestroy(heap);
+}
+
 static int IntCompare(const void *num1, const void *num2)
 {
     return (*(int *)num1 - *(int *)num2);
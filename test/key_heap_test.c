@@ -0,0 +1,109 @@
+#include <stdio.h> /* printf */
+
+#include "key_heap.h"
+
+#define LARGE_SIZE 100000
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestPushPop(size_t arity);
+static void TestPeek();
+
+static int values[LARGE_SIZE];
+
+int main()
+{
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestPushPop(2);
+	TestPushPop(4);
+	TestPushPop(8);
+	TestPeek();
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static void TestCreate()
+{
+	key_heap_t *heap = KeyHeapCreate(4, 0);
+
+	if (NULL != heap && KeyHeapIsEmpty(heap) && 0 == KeyHeapSize(heap))
+	{
+		printf("KeyHeapCreate working!                               V\n");
+	}
+	else
+	{
+		printf("KeyHeapCreate NOT working!                           X\n");
+	}
+
+	KeyHeapDestroy(heap);
+}
+
+/* starts small so the heap has to grow many times on the way */
+static void TestPushPop(size_t arity)
+{
+	key_heap_t *heap = KeyHeapCreate(arity, 1);
+	int is_working = 1;
+	size_t index = 0;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		index = (i * 7919) % LARGE_SIZE;
+		values[index] = (int)index;
+		is_working = is_working && (0 == KeyHeapPush(heap, index, &values[index]));
+	}
+
+	is_working = is_working && (LARGE_SIZE == KeyHeapSize(heap));
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && (&values[i] == KeyHeapPop(heap));
+	}
+
+	if (is_working && KeyHeapIsEmpty(heap))
+	{
+		printf("KeyHeapPush & KeyHeapPop (arity %lu) working!          V\n", (unsigned long)arity);
+	}
+	else
+	{
+		printf("KeyHeapPush & KeyHeapPop (arity %lu) NOT working!      X\n", (unsigned long)arity);
+	}
+
+	KeyHeapDestroy(heap);
+}
+
+/* equal keys all come out, in any order */
+static void TestPeek()
+{
+	key_heap_t *heap = KeyHeapCreate(4, 8);
+	int a = 1, b = 2, c = 3;
+	int is_working = 1;
+
+	KeyHeapPush(heap, 30, &c);
+	KeyHeapPush(heap, 10, &a);
+	KeyHeapPush(heap, 20, &b);
+	KeyHeapPush(heap, 10, &a);
+
+	is_working = (&a == KeyHeapPeek(heap)) && (10 == KeyHeapPeekKey(heap));
+	KeyHeapPop(heap);
+	is_working = is_working && (10 == KeyHeapPeekKey(heap));
+	KeyHeapPop(heap);
+	is_working = is_working && (&b == KeyHeapPeek(heap)) && (20 == KeyHeapPeekKey(heap));
+
+	if (is_working && 2 == KeyHeapSize(heap))
+	{
+		printf("KeyHeapPeek working!                                 V\n");
+	}
+	else
+	{
+		printf("KeyHeapPeek NOT working!                             X\n");
+	}
+
+	KeyHeapDestroy(heap);
+}
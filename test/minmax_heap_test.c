@@ -0,0 +1,225 @@
+#include <stdio.h> /* printf */
+
+#include "minmax_heap.h"
+
+#define LARGE_SIZE 100000
+#define MIXED_OPS 10000
+#define BOUND 100
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestPopMin();
+static void TestPopMax();
+static void TestMixed();
+static void TestBounded();
+static int IntCompare(const void *data1, const void *data2);
+
+static int values[LARGE_SIZE];
+
+int main()
+{
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[i] = (int)i;
+	}
+
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestPopMin();
+	TestPopMax();
+	TestMixed();
+	TestBounded();
+	printf("*Run vlg to test MinMaxHeapDestroy*\n");
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static void TestCreate()
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(IntCompare);
+
+	if (NULL != heap && MinMaxHeapIsEmpty(heap) && 0 == MinMaxHeapSize(heap))
+	{
+		printf("MinMaxHeapCreate working!                            V\n");
+	}
+	else
+	{
+		printf("MinMaxHeapCreate NOT working!                        X\n");
+	}
+
+	MinMaxHeapDestroy(heap);
+}
+
+static void TestPopMin()
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(IntCompare);
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working &&
+		             (0 == MinMaxHeapPush(heap, &values[(i * 7919) % LARGE_SIZE]));
+	}
+
+	is_working = is_working && (LARGE_SIZE == MinMaxHeapSize(heap)) &&
+	             (&values[0] == MinMaxHeapPeekMin(heap)) &&
+	             (&values[LARGE_SIZE - 1] == MinMaxHeapPeekMax(heap));
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && (&values[i] == MinMaxHeapPopMin(heap));
+	}
+
+	if (is_working && MinMaxHeapIsEmpty(heap))
+	{
+		printf("MinMaxHeapPush & MinMaxHeapPopMin working!           V\n");
+	}
+	else
+	{
+		printf("MinMaxHeapPush & MinMaxHeapPopMin NOT working!       X\n");
+	}
+
+	MinMaxHeapDestroy(heap);
+}
+
+static void TestPopMax()
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(IntCompare);
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		MinMaxHeapPush(heap, &values[(i * 7919) % LARGE_SIZE]);
+	}
+
+	for (i = LARGE_SIZE; 0 < i; --i)
+	{
+		is_working = is_working && (&values[i - 1] == MinMaxHeapPeekMax(heap)) &&
+		             (&values[i - 1] == MinMaxHeapPopMax(heap));
+	}
+
+	if (is_working && MinMaxHeapIsEmpty(heap))
+	{
+		printf("MinMaxHeapPopMax working!                            V\n");
+	}
+	else
+	{
+		printf("MinMaxHeapPopMax NOT working!                        X\n");
+	}
+
+	MinMaxHeapDestroy(heap);
+}
+
+/* pushes and pops from both ends, checked against a table of the values
+   in the heap, so the heap is seen at every size up to a few thousand */
+static void TestMixed()
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(IntCompare);
+	static int is_in[MIXED_OPS];
+	unsigned long state = 12345;
+	size_t pushed = 0;
+	size_t value = 0;
+	size_t min = 0;
+	size_t max = 0;
+	size_t size = 0;
+	size_t i = 0;
+	int is_working = 1;
+
+	for (i = 0; i < MIXED_OPS; ++i)
+	{
+		state = state * 1103515245 + 12345;
+		if (0 == size || 2 <= (state >> 16) % 5)
+		{
+			value = (pushed * 7919) % MIXED_OPS;
+			is_in[value] = 1;
+			MinMaxHeapPush(heap, &values[value]);
+			++pushed;
+			++size;
+			continue;
+		}
+
+		for (min = 0; !is_in[min]; ++min)
+		{
+		}
+		for (max = MIXED_OPS - 1; !is_in[max]; --max)
+		{
+		}
+
+		is_working = is_working && (&values[min] == MinMaxHeapPeekMin(heap)) &&
+		             (&values[max] == MinMaxHeapPeekMax(heap));
+
+		if (0 == (state >> 16) % 2)
+		{
+			is_working = is_working && (&values[min] == MinMaxHeapPopMin(heap));
+			is_in[min] = 0;
+		}
+		else
+		{
+			is_working = is_working && (&values[max] == MinMaxHeapPopMax(heap));
+			is_in[max] = 0;
+		}
+		--size;
+	}
+
+	if (is_working && size == MinMaxHeapSize(heap))
+	{
+		printf("MinMaxHeap mixed ends working!                       V\n");
+	}
+	else
+	{
+		printf("MinMaxHeap mixed ends NOT working!                   X\n");
+	}
+
+	MinMaxHeapDestroy(heap);
+}
+
+/* a bounded queue: when full, the smallest is evicted, so the BOUND
+   biggest values are left, and come out biggest first */
+static void TestBounded()
+{
+	minmax_heap_t *heap = MinMaxHeapCreate(IntCompare);
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		MinMaxHeapPush(heap, &values[(i * 7919) % LARGE_SIZE]);
+		if (BOUND < MinMaxHeapSize(heap))
+		{
+			MinMaxHeapPopMin(heap);
+		}
+	}
+
+	is_working = (BOUND == MinMaxHeapSize(heap)) &&
+	             (&values[LARGE_SIZE - BOUND] == MinMaxHeapPeekMin(heap));
+
+	for (i = LARGE_SIZE; LARGE_SIZE - BOUND < i; --i)
+	{
+		is_working = is_working && (&values[i - 1] == MinMaxHeapPopMax(heap));
+	}
+
+	if (is_working && MinMaxHeapIsEmpty(heap))
+	{
+		printf("MinMaxHeap bounded queue working!                    V\n");
+	}
+	else
+	{
+		printf("MinMaxHeap bounded queue NOT working!                X\n");
+	}
+
+	MinMaxHeapDestroy(heap);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}
@@ -0,0 +1,229 @@
+#include <stdio.h>   /* printf */
+#include <pthread.h> /* pthread_create, pthread_join */
+
+#include "multi_pq.h"
+
+#define LARGE_SIZE 100000
+#define NUM_OF_THREADS 4
+#define NUM_OF_QUEUES (2 * NUM_OF_THREADS)
+
+typedef struct thread_arg
+{
+	multi_pq_t *queue;
+	size_t first;
+}thread_arg_t;
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestStrictOrder();
+static void TestRelaxed();
+static void TestConcurrent(int is_strict);
+static int IntCompare(const void *data1, const void *data2);
+
+static int values[LARGE_SIZE];
+static int times_dequeued[LARGE_SIZE];
+static long consumed;
+
+int main()
+{
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[i] = (int)i;
+	}
+
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestStrictOrder();
+	TestRelaxed();
+	TestConcurrent(0);
+	TestConcurrent(1);
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static void TestCreate()
+{
+	multi_pq_t *relaxed = MultiPQCreate(IntCompare, NUM_OF_QUEUES);
+	multi_pq_t *strict = MultiPQCreateStrict(IntCompare, 1);
+
+	if (NULL != relaxed && NULL != strict && MultiPQIsEmpty(relaxed) &&
+	    0 == MultiPQSize(strict) && NULL == MultiPQDequeue(relaxed) &&
+	    NULL == MultiPQDequeue(strict))
+	{
+		printf("MultiPQCreate working!                               V\n");
+	}
+	else
+	{
+		printf("MultiPQCreate NOT working!                           X\n");
+	}
+
+	MultiPQDestroy(relaxed);
+	MultiPQDestroy(strict);
+}
+
+static void TestStrictOrder()
+{
+	multi_pq_t *queue = MultiPQCreateStrict(IntCompare, NUM_OF_QUEUES);
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && (0 == MultiPQEnqueue(queue, &values[(i * 7919) % LARGE_SIZE]));
+	}
+
+	is_working = is_working && (LARGE_SIZE == MultiPQSize(queue));
+
+	for (i = LARGE_SIZE; 0 < i; --i)
+	{
+		is_working = is_working && (&values[i - 1] == MultiPQDequeue(queue));
+	}
+
+	if (is_working && MultiPQIsEmpty(queue) && NULL == MultiPQDequeue(queue))
+	{
+		printf("MultiPQ strict order working!                        V\n");
+	}
+	else
+	{
+		printf("MultiPQ strict order NOT working!                    X\n");
+	}
+
+	MultiPQDestroy(queue);
+}
+
+/* every element comes out once, and the first ones out are among the best */
+static void TestRelaxed()
+{
+	multi_pq_t *queue = MultiPQCreate(IntCompare, NUM_OF_QUEUES);
+	int is_working = 1;
+	int *data = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		MultiPQEnqueue(queue, &values[(i * 7919) % LARGE_SIZE]);
+		times_dequeued[i] = 0;
+	}
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		data = (int *)MultiPQDequeue(queue);
+		is_working = is_working && (NULL != data);
+		if (NULL != data)
+		{
+			++times_dequeued[*data];
+			is_working = is_working && (100 <= i || LARGE_SIZE - 1000 <= *data);
+		}
+	}
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && (1 == times_dequeued[i]);
+	}
+
+	if (is_working && MultiPQIsEmpty(queue) && NULL == MultiPQDequeue(queue))
+	{
+		printf("MultiPQ relaxed working!                             V\n");
+	}
+	else
+	{
+		printf("MultiPQ relaxed NOT working!                         X\n");
+	}
+
+	MultiPQDestroy(queue);
+}
+
+/* each producer enqueues every NUM_OF_THREADS-th value from its own
+   first one, while the consumers take out all LARGE_SIZE between them */
+static void *Produce(void *param)
+{
+	thread_arg_t *arg = (thread_arg_t *)param;
+	size_t i = 0;
+
+	for (i = arg->first; i < LARGE_SIZE; i += NUM_OF_THREADS)
+	{
+		while (0 != MultiPQEnqueue(arg->queue, &values[i]))
+			;
+	}
+
+	return (NULL);
+}
+
+static void *Consume(void *param)
+{
+	thread_arg_t *arg = (thread_arg_t *)param;
+	int *data = NULL;
+
+	while (__atomic_load_n(&consumed, __ATOMIC_RELAXED) < LARGE_SIZE)
+	{
+		data = (int *)MultiPQDequeue(arg->queue);
+		if (NULL != data)
+		{
+			__atomic_add_fetch(&times_dequeued[*data], 1, __ATOMIC_RELAXED);
+			__atomic_add_fetch(&consumed, 1, __ATOMIC_RELAXED);
+		}
+	}
+
+	return (NULL);
+}
+
+static void TestConcurrent(int is_strict)
+{
+	multi_pq_t *queue = is_strict ? MultiPQCreateStrict(IntCompare, NUM_OF_QUEUES) :
+	                                MultiPQCreate(IntCompare, NUM_OF_QUEUES);
+	thread_arg_t args[NUM_OF_THREADS];
+	pthread_t producers[NUM_OF_THREADS];
+	pthread_t consumers[NUM_OF_THREADS];
+	int is_working = 1;
+	size_t i = 0;
+
+	consumed = 0;
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		times_dequeued[i] = 0;
+	}
+
+	for (i = 0; i < NUM_OF_THREADS; ++i)
+	{
+		args[i].queue = queue;
+		args[i].first = i;
+		pthread_create(&consumers[i], NULL, Consume, &args[i]);
+		pthread_create(&producers[i], NULL, Produce, &args[i]);
+	}
+
+	for (i = 0; i < NUM_OF_THREADS; ++i)
+	{
+		pthread_join(producers[i], NULL);
+		pthread_join(consumers[i], NULL);
+	}
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working && (1 == times_dequeued[i]);
+	}
+
+	if (is_working && MultiPQIsEmpty(queue))
+	{
+		printf(is_strict ? "MultiPQ concurrent strict working!                   V\n" :
+		                   "MultiPQ concurrent relaxed working!                  V\n");
+	}
+	else
+	{
+		printf(is_strict ? "MultiPQ concurrent strict NOT working!               X\n" :
+		                   "MultiPQ concurrent relaxed NOT working!              X\n");
+	}
+
+	MultiPQDestroy(queue);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}
@@ -0,0 +1,136 @@
+#include <stdio.h> /* printf */
+
+#include "pairing_heap.h"
+
+#define LARGE_SIZE 100000
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestPushPop();
+static void TestMerge();
+static int IntCompare(const void *data1, const void *data2);
+
+static int values[LARGE_SIZE];
+
+int main()
+{
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[i] = (int)i;
+	}
+
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestPushPop();
+	TestMerge();
+	printf("*Run vlg to test PairingHeapDestroy*\n");
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static void TestCreate()
+{
+	pairing_heap_t *heap = PairingHeapCreate(IntCompare);
+
+	if (NULL != heap && PairingHeapIsEmpty(heap) && 0 == PairingHeapSize(heap))
+	{
+		printf("PairingHeapCreate working!                           V\n");
+	}
+	else
+	{
+		printf("PairingHeapCreate NOT working!                       X\n");
+	}
+
+	PairingHeapDestroy(heap);
+}
+
+static void TestPushPop()
+{
+	pairing_heap_t *heap = PairingHeapCreate(IntCompare);
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		is_working = is_working &&
+		             (0 == PairingHeapPush(heap, &values[(i * 7919) % LARGE_SIZE]));
+	}
+
+	is_working = is_working && (LARGE_SIZE == PairingHeapSize(heap)) &&
+	             (&values[LARGE_SIZE - 1] == PairingHeapPeek(heap));
+
+	for (i = LARGE_SIZE; 0 < i; --i)
+	{
+		is_working = is_working && (&values[i - 1] == PairingHeapPop(heap));
+	}
+
+	if (is_working && PairingHeapIsEmpty(heap))
+	{
+		printf("PairingHeapPush & PairingHeapPop working!            V\n");
+	}
+	else
+	{
+		printf("PairingHeapPush & PairingHeapPop NOT working!        X\n");
+	}
+
+	PairingHeapDestroy(heap);
+}
+
+/* odd values in one heap, even in the other. both are left half full when
+   destroyed, so freeing whole trees is covered too */
+static void TestMerge()
+{
+	pairing_heap_t *odd = PairingHeapCreate(IntCompare);
+	pairing_heap_t *even = PairingHeapCreate(IntCompare);
+	pairing_heap_t *empty = PairingHeapCreate(IntCompare);
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		PairingHeapPush((0 == i % 2) ? even : odd, &values[(i * 7919) % LARGE_SIZE]);
+	}
+
+	PairingHeapMerge(empty, odd);
+	PairingHeapMerge(even, empty);
+	PairingHeapMerge(even, odd);
+
+	is_working = PairingHeapIsEmpty(odd) && PairingHeapIsEmpty(empty) &&
+	             (LARGE_SIZE == PairingHeapSize(even));
+
+	for (i = LARGE_SIZE; LARGE_SIZE / 2 < i; --i)
+	{
+		is_working = is_working && (&values[i - 1] == PairingHeapPop(even));
+	}
+
+	PairingHeapPush(odd, &values[0]);
+	PairingHeapMerge(odd, even);
+
+	is_working = is_working && (LARGE_SIZE / 2 + 1 == PairingHeapSize(odd)) &&
+	             (&values[LARGE_SIZE / 2 - 1] == PairingHeapPeek(odd));
+
+	if (is_working)
+	{
+		printf("PairingHeapMerge working!                            V\n");
+	}
+	else
+	{
+		printf("PairingHeapMerge NOT working!                        X\n");
+	}
+
+	PairingHeapDestroy(odd);
+	PairingHeapDestroy(even);
+	PairingHeapDestroy(empty);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}
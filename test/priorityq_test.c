@@ -2,6 +2,8 @@
 
 #include "priorityq.h"
 
+#define STABLE_SIZE 1000
+
 static void TestAllFuncs();
 static void TestCreate();
 static void TestDestroy();
@@ -10,6 +12,7 @@ static void TestEnqueueNDequeue();
 static void TestSizeAndEmpty();
 static void TestErase();
 static void TestPeek();
+static void TestStable();
 
 static int SortBySize(const void *data, const void *data2);
 static int DivideMatch(const void *data, const void *param);
@@ -28,6 +31,7 @@ static void TestAllFuncs()
 	TestSizeAndEmpty();
 	TestErase();
 	TestPeek();
+	TestStable();
 	TestClear();
 	TestDestroy();
 	printf("      ~END OF TEST FUNCTION~ \n");
@@ -215,6 +219,48 @@ static void TestClear()
 	PriorityQDestroy(queue);
 }
 
+/* ten priorities, a hundred elements each, enqueued round robin and
+   half of them dequeued on the way - each priority must come out in the
+   order it went in */
+static void TestStable()
+{
+	static int values[STABLE_SIZE];
+	int *prev = NULL;
+	int *curr = NULL;
+	int is_working = 1;
+	size_t i = 0;
+	priority_q_t *queue = PriorityQCreate(SortBySize);
+
+	for (i = 0; i < STABLE_SIZE; ++i)
+	{
+		values[i] = (int)(i % 10);
+		PriorityQEnqueue(queue, &values[i]);
+		if (1 == i % 2)
+		{
+			curr = (int *)PriorityQDequeue(queue);
+			is_working = is_working && (NULL == prev || *prev > *curr || prev < curr);
+			prev = curr;
+		}
+	}
+
+	for (prev = NULL; !PriorityQIsEmpty(queue); prev = curr)
+	{
+		curr = (int *)PriorityQDequeue(queue);
+		is_working = is_working && (NULL == prev || *prev > *curr || prev < curr);
+	}
+
+	if (is_working)
+	{
+		printf("PriorityQ FIFO on equal priority working!            V\n");
+	}
+	else
+	{
+		printf("PriorityQ FIFO on equal priority NOT working!        X\n");
+	}
+
+	PriorityQDestroy(queue);
+}
+
 static int SortBySize(const void *data, const void *data2)
 {
 	return (*(int*)data - *(int*)data2);
@@ -0,0 +1,200 @@
+#include <stdio.h> /* printf */
+
+#include "radix_heap.h"
+
+#define LARGE_SIZE 100000
+#define TIMER_SPAN 1000
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestEnqueueDequeue();
+static void TestMonotone();
+static void TestPeekEnqueue();
+static void TestClear();
+
+static unsigned long keys[LARGE_SIZE];
+
+int main()
+{
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestEnqueueDequeue();
+	TestMonotone();
+	TestPeekEnqueue();
+	TestClear();
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static void TestCreate()
+{
+	radix_heap_t *heap = RadixHeapCreate();
+
+	if (NULL != heap && RadixHeapIsEmpty(heap) && 0 == RadixHeapSize(heap))
+	{
+		printf("RadixHeapCreate working!                             V\n");
+	}
+	else
+	{
+		printf("RadixHeapCreate NOT working!                         X\n");
+	}
+
+	RadixHeapDestroy(heap);
+}
+
+/* keys spread over the whole range, with every key twice */
+static void TestEnqueueDequeue()
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	int is_working = 1;
+	unsigned long *data = NULL;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		keys[i] = ((i / 2) * 2654435761UL) & 0xffffffffUL;
+		is_working = is_working && (0 == RadixHeapEnqueue(heap, keys[i], &keys[i]));
+	}
+
+	is_working = is_working && (LARGE_SIZE == RadixHeapSize(heap)) &&
+	             (0 == RadixHeapPeekKey(heap)) && (0 == *(unsigned long *)RadixHeapPeek(heap));
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		data = (unsigned long *)RadixHeapDequeue(heap);
+		is_working = is_working && (NULL != data) &&
+		             (RadixHeapIsEmpty(heap) || *data <= RadixHeapPeekKey(heap));
+	}
+
+	if (is_working && RadixHeapIsEmpty(heap))
+	{
+		printf("RadixHeapEnqueue & RadixHeapDequeue working!         V\n");
+	}
+	else
+	{
+		printf("RadixHeapEnqueue & RadixHeapDequeue NOT working!     X\n");
+	}
+
+	RadixHeapDestroy(heap);
+}
+
+/* a timer wheel: every event fired schedules one a little later, and
+   nothing may be scheduled before the last one fired */
+static void TestMonotone()
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	unsigned long now = 0;
+	unsigned long *fired = NULL;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE / 10; ++i)
+	{
+		keys[i] = (i * 7919) % TIMER_SPAN;
+		RadixHeapEnqueue(heap, keys[i], &keys[i]);
+	}
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		fired = (unsigned long *)RadixHeapDequeue(heap);
+		is_working = is_working && (now <= *fired);
+		now = *fired;
+		*fired = now + (i * 7919) % TIMER_SPAN;
+		is_working = is_working && (0 == RadixHeapEnqueue(heap, *fired, fired));
+	}
+
+	is_working = is_working && (LARGE_SIZE / 10 == RadixHeapSize(heap)) &&
+	             (0 != now) && (1 == RadixHeapEnqueue(heap, now - 1, &now));
+
+	if (is_working)
+	{
+		printf("RadixHeap monotone keys working!                     V\n");
+	}
+	else
+	{
+		printf("RadixHeap monotone keys NOT working!                 X\n");
+	}
+
+	RadixHeapDestroy(heap);
+}
+
+/* peeks the next timer, then arms one that is due sooner but not before
+   the last that fired - every such key must be accepted */
+static void TestPeekEnqueue()
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	unsigned long values[3] = {10, 100, 50};
+	unsigned long now = 0;
+	unsigned long next = 0;
+	unsigned long *fired = NULL;
+	int is_working = 1;
+	size_t i = 0;
+
+	RadixHeapEnqueue(heap, values[0], &values[0]);
+	RadixHeapEnqueue(heap, values[1], &values[1]);
+	is_working = (&values[0] == RadixHeapDequeue(heap)) &&
+	             (100 == RadixHeapPeekKey(heap)) && (&values[1] == RadixHeapPeek(heap)) &&
+	             (0 == RadixHeapEnqueue(heap, values[2], &values[2])) &&
+	             (50 == RadixHeapPeekKey(heap)) && (&values[2] == RadixHeapDequeue(heap)) &&
+	             (&values[1] == RadixHeapDequeue(heap));
+
+	for (i = 0; i < LARGE_SIZE / 10; ++i)
+	{
+		keys[i] = TIMER_SPAN + (i * 7919) % TIMER_SPAN;
+		RadixHeapEnqueue(heap, keys[i], &keys[i]);
+	}
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		fired = (unsigned long *)RadixHeapDequeue(heap);
+		is_working = is_working && (now <= *fired);
+		now = *fired;
+		next = RadixHeapPeekKey(heap);
+		*fired = now + (next - now) / 2;
+		is_working = is_working && (next == *(unsigned long *)RadixHeapPeek(heap)) &&
+		             (0 == RadixHeapEnqueue(heap, *fired, fired)) &&
+		             (*fired == RadixHeapPeekKey(heap));
+	}
+
+	if (is_working && LARGE_SIZE / 10 == RadixHeapSize(heap))
+	{
+		printf("RadixHeap enqueue after peek working!                V\n");
+	}
+	else
+	{
+		printf("RadixHeap enqueue after peek NOT working!            X\n");
+	}
+
+	RadixHeapDestroy(heap);
+}
+
+static void TestClear()
+{
+	radix_heap_t *heap = RadixHeapCreate();
+	unsigned long key = 5;
+	int is_working = 1;
+
+	RadixHeapEnqueue(heap, 10, &key);
+	RadixHeapEnqueue(heap, 20, &key);
+	RadixHeapDequeue(heap);
+	RadixHeapClear(heap);
+
+	is_working = RadixHeapIsEmpty(heap) && (0 == RadixHeapEnqueue(heap, 5, &key)) &&
+	             (5 == RadixHeapPeekKey(heap)) && (1 == RadixHeapSize(heap));
+
+	if (is_working)
+	{
+		printf("RadixHeapClear working!                              V\n");
+	}
+	else
+	{
+		printf("RadixHeapClear NOT working!                          X\n");
+	}
+
+	RadixHeapDestroy(heap);
+}
@@ -0,0 +1,155 @@
+#include <stdio.h>	/* printf */
+
+#include "rankselect.h"
+
+#define NUM_OF_BITS 300000
+
+static void TestAllFuncs();
+
+int main()
+{
+	TestAllFuncs();
+	return (0);
+}
+
+/* a mix of dense runs, sparse stretches and an empty tail */
+static bitvector_ptr_t CreatePattern()
+{
+	bitvector_ptr_t vector = BitVectorCreate(NUM_OF_BITS);
+	size_t i = 0;
+
+	BitVectorSetRangeOn(vector, 1000, 70000);
+
+	for (i = 70000; i < 200000; i += 37)
+	{
+		BitVectorSetOn(vector, i);
+	}
+
+	BitVectorSetOn(vector, 250001);
+
+	return (vector);
+}
+
+static void TestCreate()
+{
+	bitvector_ptr_t vector = CreatePattern();
+	rank_select_ptr_t index = RankSelectCreate(vector);
+
+	if (NULL != index && RankSelectCountOn(index) ==
+	    BitVectorCountOn(vector, 0, NUM_OF_BITS))
+	{
+		printf("RankSelectCreate working!             V\n");
+	}
+	else
+	{
+		printf("RankSelectCreate NOT working!         X\n");
+	}
+
+	RankSelectDestroy(index);
+	BitVectorDestroy(vector);
+}
+
+static void TestRank()
+{
+	bitvector_ptr_t vector = CreatePattern();
+	rank_select_ptr_t index = RankSelectCreate(vector);
+	size_t expected = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i <= NUM_OF_BITS; ++i)
+	{
+		is_working = is_working && (expected == RankSelectRank(index, i));
+
+		if (i < NUM_OF_BITS)
+		{
+			expected += BitVectorGetVal(vector, i);
+		}
+	}
+
+	if (is_working)
+	{
+		printf("RankSelectRank working!               V\n");
+	}
+	else
+	{
+		printf("RankSelectRank NOT working!           X\n");
+	}
+
+	RankSelectDestroy(index);
+	BitVectorDestroy(vector);
+}
+
+static void TestSelect()
+{
+	bitvector_ptr_t vector = CreatePattern();
+	rank_select_ptr_t index = RankSelectCreate(vector);
+	size_t k = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < NUM_OF_BITS; ++i)
+	{
+		if (BitVectorGetVal(vector, i))
+		{
+			is_working = is_working && (i == RankSelectSelect(index, k));
+			++k;
+		}
+	}
+
+	is_working = is_working &&
+	             (NUM_OF_BITS == RankSelectSelect(index, k)) &&
+	             (NUM_OF_BITS == RankSelectSelect(index, k + 1000));
+
+	if (is_working)
+	{
+		printf("RankSelectSelect working!             V\n");
+	}
+	else
+	{
+		printf("RankSelectSelect NOT working!         X\n");
+	}
+
+	RankSelectDestroy(index);
+	BitVectorDestroy(vector);
+}
+
+static void TestEdges()
+{
+	bitvector_ptr_t empty = BitVectorCreate(0);
+	bitvector_ptr_t full = BitVectorCreate(1024);
+	rank_select_ptr_t empty_index = RankSelectCreate(empty);
+	rank_select_ptr_t full_index = NULL;
+	int is_working = 1;
+
+	BitVectorSetRangeOn(full, 0, 1024);
+	full_index = RankSelectCreate(full);
+
+	is_working = (0 == RankSelectRank(empty_index, 0)) &&
+	             (0 == RankSelectSelect(empty_index, 0)) &&
+	             (1024 == RankSelectRank(full_index, 1024)) &&
+	             (1023 == RankSelectSelect(full_index, 1023)) &&
+	             (1024 == RankSelectSelect(full_index, 1024));
+
+	if (is_working)
+	{
+		printf("RankSelect edge cases working!        V\n");
+	}
+	else
+	{
+		printf("RankSelect edge cases NOT working!    X\n");
+	}
+
+	RankSelectDestroy(full_index);
+	RankSelectDestroy(empty_index);
+	BitVectorDestroy(full);
+	BitVectorDestroy(empty);
+}
+
+static void TestAllFuncs()
+{
+	TestCreate();
+	TestRank();
+	TestSelect();
+	TestEdges();
+}
@@ -2,11 +2,14 @@
 
 #include "scheduler_heap.h"
 
+#define NUM_OF_TASKS 100000
+
 static void TestAllFuncs();
 static void TestCreate();
 static void TestDestroy();
 static void TestAddTask();
 static void TestRemoveTask();
+static void TestRemoveMany();
 static void TestSizeNIsEmpty();
 static void TestClear();
 static void TestRunNStop();
@@ -27,6 +30,7 @@ static void TestAllFuncs()
 	TestCreate();
 	TestAddTask();
 	TestRemoveTask();
+	TestRemoveMany();
 	TestSizeNIsEmpty();
 	TestClear();
 	TestRunNStop();
@@ -118,6 +122,45 @@ static void TestRemoveTask()
 	HSchedulerDestroy(scheduler);
 }
 
+/* cancels a large scheduler's tasks in scattered order, each one once */
+static void TestRemoveMany()
+{
+	static UID_t uids[NUM_OF_TASKS];
+	int num = 5;
+	int is_working = 1;
+	size_t i = 0;
+	scheduler_t *scheduler = HSchedulerCreate();
+	
+	for(i = 0; i < NUM_OF_TASKS; ++i)
+	{
+		uids[i] = HSchedulerAddTask(scheduler, PrintNum, (void*)&num, 10 + i % 50);
+		is_working = is_working && !UIDIsSame(badUID, uids[i]);
+	}
+	
+	for(i = 0; i < NUM_OF_TASKS; ++i)
+	{
+		UID_t uid = uids[(i * 7919) % NUM_OF_TASKS];
+		
+		is_working = is_working && (1 == HSchedulerRemoveTask(scheduler, uid)) &&
+		             (0 == HSchedulerRemoveTask(scheduler, uid)) &&
+		             (NUM_OF_TASKS - i - 1 == HSchedulerSize(scheduler));
+	}
+	
+	is_working = is_working && (0 == HSchedulerRemoveTask(scheduler, badUID)) &&
+	             HSchedulerIsEmpty(scheduler);
+	
+	if(is_working)
+	{
+		printf("HSchedulerRemoveTask many working!                    V\n");
+	}
+	else
+	{
+		printf("HSchedulerRemoveTask many NOT working!                X\n");
+	}
+	
+	HSchedulerDestroy(scheduler);
+}
+
 static void TestSizeNIsEmpty()
 {
 	int num1 = 5;
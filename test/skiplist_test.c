@@ -0,0 +1,469 @@
+#define _POSIX_C_SOURCE 200112L /* sched_yield */
+
+#include <stdio.h>   /* printf */
+#include <stddef.h>  /* size_t */
+#include <pthread.h> /* pthread_create, pthread_join */
+#include <sched.h>   /* sched_yield */
+
+#include "skiplist.h"
+
+#define NUM_OF_ELEMENTS 20000
+#define NUM_OF_THREADS 4
+#define RECLAIM_ROUNDS 50
+#define RECLAIM_KEYS 1000
+
+/* live heap blocks are counted by wrapping malloc and free, unless a
+   sanitizer owns the allocator */
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define COUNTS_BLOCKS
+#endif
+
+static int IntCompare(const void *data1, const void *data2);
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestInsertFind();
+static void TestRemove();
+static void TestIter();
+static void TestConcurrent();
+static void TestReclaim();
+
+static int elements[NUM_OF_ELEMENTS];
+
+typedef struct worker
+{
+	skiplist_t *list;
+	size_t first;
+	int is_working;
+}worker_t;
+
+typedef struct reader
+{
+	skiplist_t *list;
+	int me;
+	size_t sections;
+}reader_t;
+
+static int turn = 0;
+static int stop = 0;
+static long live_blocks = 0;
+
+#ifdef COUNTS_BLOCKS
+extern void *__libc_malloc(size_t size);
+extern void __libc_free(void *ptr);
+
+void *malloc(size_t size)
+{
+	void *ptr = __libc_malloc(size);
+
+	if (NULL != ptr)
+	{
+		__atomic_add_fetch(&live_blocks, 1, __ATOMIC_RELAXED);
+	}
+
+	return (ptr);
+}
+
+void free(void *ptr)
+{
+	if (NULL != ptr)
+	{
+		__atomic_sub_fetch(&live_blocks, 1, __ATOMIC_RELAXED);
+	}
+
+	__libc_free(ptr);
+}
+#endif /* COUNTS_BLOCKS */
+
+int main()
+{
+	size_t i = 0;
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		elements[i] = (int)i;
+	}
+
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestInsertFind();
+	TestRemove();
+	TestIter();
+	TestConcurrent();
+	TestReclaim();
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static skiplist_t *CreateFull()
+{
+	skiplist_t *list = SkipListCreate(IntCompare);
+	size_t i = 0;
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		SkipListInsert(list, &elements[(i * 7919) % NUM_OF_ELEMENTS]);
+	}
+
+	return (list);
+}
+
+static void TestCreate()
+{
+	skiplist_t *list = SkipListCreate(IntCompare);
+	int ticket = 0;
+
+	ticket = SkipListReadBegin(list);
+
+	if (NULL != list && 0 == SkipListSize(list) &&
+	    SkipListIsEqual(SkipListEnd(list), SkipListBegin(list)))
+	{
+		printf("SkipListCreate working!                              V\n");
+	}
+	else
+	{
+		printf("SkipListCreate NOT working!                          X\n");
+	}
+
+	SkipListReadEnd(list, ticket);
+	SkipListDestroy(list);
+}
+
+static void TestInsertFind()
+{
+	skiplist_t *list = CreateFull();
+	int missing = NUM_OF_ELEMENTS;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		is_working = is_working && (&elements[i] == SkipListFind(list, &elements[i]));
+	}
+
+	is_working = is_working && (NULL == SkipListFind(list, &missing)) &&
+	             (1 == SkipListInsert(list, &elements[3])) &&
+	             (NUM_OF_ELEMENTS == SkipListSize(list));
+
+	if (is_working)
+	{
+		printf("SkipListInsert & SkipListFind working!               V\n");
+	}
+	else
+	{
+		printf("SkipListInsert & SkipListFind NOT working!           X\n");
+	}
+
+	SkipListDestroy(list);
+}
+
+static void TestRemove()
+{
+	skiplist_t *list = CreateFull();
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 1; i < NUM_OF_ELEMENTS; i += 2)
+	{
+		is_working = is_working && (&elements[i] == SkipListRemove(list, &elements[i]));
+	}
+
+	is_working = is_working && (NULL == SkipListRemove(list, &elements[1])) &&
+	             (NUM_OF_ELEMENTS / 2 == SkipListSize(list));
+
+	for (i = 0; i < NUM_OF_ELEMENTS; ++i)
+	{
+		is_working = is_working &&
+		             ((0 == i % 2) == (NULL != SkipListFind(list, &elements[i])));
+	}
+
+	if (is_working)
+	{
+		printf("SkipListRemove working!                              V\n");
+	}
+	else
+	{
+		printf("SkipListRemove NOT working!                          X\n");
+	}
+
+	SkipListDestroy(list);
+}
+
+static void TestIter()
+{
+	skiplist_t *list = CreateFull();
+	skiplist_iter_t runner = NULL;
+	int from = 501;
+	int expected = 0;
+	int ticket = 0;
+	int is_working = 1;
+
+	ticket = SkipListReadBegin(list);
+
+	for (runner = SkipListBegin(list); !SkipListIsEqual(runner, SkipListEnd(list));
+	     runner = SkipListIterNext(runner))
+	{
+		is_working = is_working && (expected == *(int *)SkipListGetData(runner));
+		++expected;
+	}
+
+	SkipListRemove(list, &elements[from]);
+	runner = SkipListLowerBound(list, &from);
+
+	is_working = is_working && (NUM_OF_ELEMENTS == expected) &&
+	             (from + 1 == *(int *)SkipListGetData(runner));
+
+	SkipListReadEnd(list, ticket);
+
+	if (is_working)
+	{
+		printf("SkipList iterators working!                          V\n");
+	}
+	else
+	{
+		printf("SkipList iterators NOT working!                      X\n");
+	}
+
+	SkipListDestroy(list);
+}
+
+/* every thread owns a share of the keys, while all of them read everything */
+static void *Work(void *param)
+{
+	worker_t *worker = (worker_t *)param;
+	size_t round = 0;
+	size_t i = 0;
+
+	for (round = 0; round < 3; ++round)
+	{
+		for (i = worker->first; i < NUM_OF_ELEMENTS; i += NUM_OF_THREADS)
+		{
+			worker->is_working = worker->is_working &&
+			                     (0 == SkipListInsert(worker->list, &elements[i]));
+			SkipListFind(worker->list, &elements[(i * 31) % NUM_OF_ELEMENTS]);
+		}
+
+		for (i = worker->first; i < NUM_OF_ELEMENTS; i += 2 * NUM_OF_THREADS)
+		{
+			worker->is_working = worker->is_working &&
+			                     (&elements[i] == SkipListRemove(worker->list, &elements[i]));
+			worker->is_working = worker->is_working &&
+			                     (NULL == SkipListFind(worker->list, &elements[i]));
+		}
+
+		/* empty its share again, except in the last round */
+		for (i = worker->first; round < 2 && i < NUM_OF_ELEMENTS; i += NUM_OF_THREADS)
+		{
+			SkipListRemove(worker->list, &elements[i]);
+		}
+	}
+
+	return (NULL);
+}
+
+static void TestConcurrent()
+{
+	skiplist_t *list = SkipListCreate(IntCompare);
+	pthread_t threads[NUM_OF_THREADS];
+	worker_t workers[NUM_OF_THREADS];
+	skiplist_iter_t runner = NULL;
+	int expected = 0;
+	int ticket = 0;
+	int is_working = 1;
+	size_t i = 0;
+
+	for (i = 0; i < NUM_OF_THREADS; ++i)
+	{
+		workers[i].list = list;
+		workers[i].first = i;
+		workers[i].is_working = 1;
+		pthread_create(&threads[i], NULL, Work, &workers[i]);
+	}
+
+	for (i = 0; i < NUM_OF_THREADS; ++i)
+	{
+		pthread_join(threads[i], NULL);
+		is_working = is_working && workers[i].is_working;
+	}
+
+	/* in the last round each thread removed every other one of its keys */
+	ticket = SkipListReadBegin(list);
+
+	for (runner = SkipListBegin(list); !SkipListIsEqual(runner, SkipListEnd(list));
+	     runner = SkipListIterNext(runner))
+	{
+		while (expected % (2 * NUM_OF_THREADS) < NUM_OF_THREADS)
+		{
+			++expected;
+		}
+
+		is_working = is_working && (expected == *(int *)SkipListGetData(runner));
+		++expected;
+	}
+
+	SkipListReadEnd(list, ticket);
+
+	is_working = is_working && (NUM_OF_ELEMENTS / 2 == SkipListSize(list));
+
+	if (is_working)
+	{
+		printf("SkipList concurrent use working!                     V\n");
+	}
+	else
+	{
+		printf("SkipList concurrent use NOT working!                 X\n");
+	}
+
+	SkipListDestroy(list);
+}
+
+/*
+ * two readers hand over to each other, each ending its section only once
+ * the other has begun one, so some reader is always inside the list while
+ * it is searched and walked
+ */
+static void *Read(void *param)
+{
+	reader_t *reader = (reader_t *)param;
+	skiplist_iter_t runner = NULL;
+	int key = 0;
+	int ticket = 0;
+	int i = 0;
+
+	while (1)
+	{
+		while (reader->me != __atomic_load_n(&turn, __ATOMIC_ACQUIRE) &&
+		       !__atomic_load_n(&stop, __ATOMIC_ACQUIRE))
+		{
+			sched_yield();
+		}
+
+		if (__atomic_load_n(&stop, __ATOMIC_ACQUIRE))
+		{
+			return (NULL);
+		}
+
+		ticket = SkipListReadBegin(reader->list);
+		key = (int)((reader->sections * 7919) % RECLAIM_KEYS);
+		SkipListFind(reader->list, &key);
+
+		runner = SkipListLowerBound(reader->list, &key);
+		for (i = 0; i < 8 && !SkipListIsEqual(runner, SkipListEnd(reader->list)); ++i)
+		{
+			runner = SkipListIterNext(runner);
+		}
+
+		__atomic_store_n(&turn, !reader->me, __ATOMIC_RELEASE);
+
+		while (reader->me != __atomic_load_n(&turn, __ATOMIC_ACQUIRE) &&
+		       !__atomic_load_n(&stop, __ATOMIC_ACQUIRE))
+		{
+			sched_yield();
+		}
+
+		SkipListReadEnd(reader->list, ticket);
+		__atomic_add_fetch(&reader->sections, 1, __ATOMIC_RELEASE);
+	}
+}
+
+/* both readers end two more sections, so none that began before is left */
+static void WaitSections(reader_t *readers)
+{
+	size_t first[2];
+	int i = 0;
+
+	for (i = 0; i < 2; ++i)
+	{
+		first[i] = __atomic_load_n(&readers[i].sections, __ATOMIC_ACQUIRE);
+	}
+
+	for (i = 0; i < 2; ++i)
+	{
+		while (__atomic_load_n(&readers[i].sections, __ATOMIC_ACQUIRE) < first[i] + 2)
+		{
+			sched_yield();
+		}
+	}
+}
+
+/*
+ * removes while reads never stop overlapping. the removed nodes must still
+ * be freed along the way - at most two rounds of them may be waiting
+ */
+static void TestReclaim()
+{
+	skiplist_t *list = SkipListCreate(IntCompare);
+	pthread_t threads[2];
+	reader_t readers[2];
+	long first_blocks = 0;
+	long most_blocks = 0;
+	size_t round = 0;
+	size_t i = 0;
+	int is_working = 1;
+
+	turn = 0;
+	stop = 0;
+
+	for (i = 0; i < 2; ++i)
+	{
+		readers[i].list = list;
+		readers[i].me = (int)i;
+		readers[i].sections = 0;
+		pthread_create(&threads[i], NULL, Read, &readers[i]);
+	}
+
+	WaitSections(readers);
+	first_blocks = __atomic_load_n(&live_blocks, __ATOMIC_RELAXED);
+
+	for (round = 0; round < RECLAIM_ROUNDS; ++round)
+	{
+		for (i = 0; i < RECLAIM_KEYS; ++i)
+		{
+			is_working = is_working && (0 == SkipListInsert(list, &elements[i]));
+		}
+
+		for (i = 0; i < RECLAIM_KEYS; ++i)
+		{
+			is_working = is_working &&
+			             (&elements[i] == SkipListRemove(list, &elements[i]));
+		}
+
+		WaitSections(readers);
+
+		if (most_blocks < __atomic_load_n(&live_blocks, __ATOMIC_RELAXED) - first_blocks)
+		{
+			most_blocks = __atomic_load_n(&live_blocks, __ATOMIC_RELAXED) - first_blocks;
+		}
+	}
+
+	__atomic_store_n(&stop, 1, __ATOMIC_RELEASE);
+
+	for (i = 0; i < 2; ++i)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	is_working = is_working && (0 == SkipListSize(list)) &&
+	             (3 * RECLAIM_KEYS > most_blocks);
+
+	if (is_working)
+	{
+		printf("SkipList frees under overlapping reads working!      V\n");
+	}
+	else
+	{
+		printf("SkipList frees under overlapping reads NOT working!  X\n");
+	}
+
+	SkipListDestroy(list);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}
@@ -0,0 +1,142 @@
+#include <stdio.h> /* printf */
+
+#include "topk.h"
+
+#define LARGE_SIZE 100000
+#define K 100
+
+static void TestAllFuncs();
+static void TestCreate();
+static void TestOffer();
+static void TestOfferBatch();
+static int IntCompare(const void *data1, const void *data2);
+
+static int values[LARGE_SIZE];
+static void *elements[LARGE_SIZE];
+
+int main()
+{
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		values[i] = (int)((i * 7919) % LARGE_SIZE);
+		elements[i] = &values[i];
+	}
+
+	TestAllFuncs();
+	return (0);
+}
+
+static void TestAllFuncs()
+{
+	printf("     ~START OF TEST FUNCTION~ \n");
+	TestCreate();
+	TestOffer();
+	TestOfferBatch();
+	printf("      ~END OF TEST FUNCTION~ \n");
+}
+
+static void TestCreate()
+{
+	topk_t *topk = TopKCreate(IntCompare, K);
+
+	if (NULL != topk && 0 == TopKSize(topk))
+	{
+		printf("TopKCreate working!                                  V\n");
+	}
+	else
+	{
+		printf("TopKCreate NOT working!                              X\n");
+	}
+
+	TopKDestroy(topk);
+}
+
+/* the drained elements are the K biggest, biggest first */
+static int CheckDrained(topk_t *topk)
+{
+	void *dest[K];
+	int is_working = (K == TopKDrain(topk, dest)) && (0 == TopKSize(topk));
+	size_t i = 0;
+
+	for (i = 0; i < K; ++i)
+	{
+		is_working = is_working && ((int)(LARGE_SIZE - 1 - i) == *(int *)dest[i]);
+	}
+
+	return (is_working);
+}
+
+static void TestOffer()
+{
+	topk_t *topk = TopKCreate(IntCompare, K);
+	int is_working = 1;
+	int kept = 0;
+	size_t i = 0;
+
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		kept += TopKOffer(topk, elements[i]);
+	}
+
+	is_working = (K == TopKSize(topk)) && (LARGE_SIZE - K == *(int *)TopKThreshold(topk)) &&
+	             (K <= kept) && (0 == TopKOffer(topk, TopKThreshold(topk))) &&
+	             CheckDrained(topk);
+
+	/* a second stream after the drain */
+	for (i = 0; i < LARGE_SIZE; ++i)
+	{
+		TopKOffer(topk, elements[LARGE_SIZE - 1 - i]);
+	}
+	is_working = is_working && CheckDrained(topk);
+
+	if (is_working)
+	{
+		printf("TopKOffer & TopKDrain working!                       V\n");
+	}
+	else
+	{
+		printf("TopKOffer & TopKDrain NOT working!                   X\n");
+	}
+
+	TopKDestroy(topk);
+}
+
+/* uneven batches, the first shorter than K */
+static void TestOfferBatch()
+{
+	topk_t *topk = TopKCreate(IntCompare, K);
+	size_t kept = 0;
+	size_t i = 0;
+	size_t batch = K / 2;
+	int is_working = 1;
+
+	for (i = 0; i < LARGE_SIZE; i += batch, batch = batch * 2 + 1)
+	{
+		if (LARGE_SIZE - i < batch)
+		{
+			batch = LARGE_SIZE - i;
+		}
+		kept += TopKOfferBatch(topk, elements + i, batch);
+	}
+
+	is_working = (K <= kept) && (K == TopKSize(topk)) && (0 == TopKOfferBatch(topk, elements, 0)) &&
+	             CheckDrained(topk);
+
+	if (is_working)
+	{
+		printf("TopKOfferBatch working!                              V\n");
+	}
+	else
+	{
+		printf("TopKOfferBatch NOT working!                          X\n");
+	}
+
+	TopKDestroy(topk);
+}
+
+static int IntCompare(const void *data1, const void *data2)
+{
+	return (*(int *)data1 - *(int *)data2);
+}